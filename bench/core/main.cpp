@@ -0,0 +1,417 @@
+// Core-path micro-benchmarks with pass/fail budgets
+//
+// Builds only pure-logic code (no SDL, no LovyanGFX) against the HEADLESS
+// platform shim. Each case runs a fixed number of operations, keeps the best
+// of several runs and compares ns/op with a budget. Budgets are generous
+// host-side ceilings meant to catch order-of-magnitude regressions. A few
+// check cases assert behavior (e.g. baseline recovery) against a limit
+// instead. The exit code is non-zero if any case is over budget.
+//
+// Usage: program [budget-scale]
+//   budget-scale: multiply every budget (default 1.0, e.g. 4 on slow CI)
+
+#include "Platform.h"
+#include "config.h"
+#include "core/gfx/Blend565.h"
+#include "core/gfx/Color565.h"
+#include "core/hardware/BaselineTracker.h"
+#include "core/hardware/BreathData.h"
+#include "core/hardware/BreathFilter.h"
+#include "core/hardware/BreathRecording.h"
+#include "core/perf/FrameProfiler.h"
+#include "core/util/DecayingQuantile.h"
+#include "core/util/EntityPool.h"
+#include "core/util/RingBuffer.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+// ========================================
+// Global Application State
+// ========================================
+SerialMock Serial;
+
+BreathData breathData;
+
+// Results feed this so the optimizer cannot drop the measured work
+static volatile uint32_t sink;
+
+// ========================================
+// Synthetic Input
+// ========================================
+static const int TRACE_LENGTH = 4096;  // Power of two
+static float trace[TRACE_LENGTH];
+
+// 100 Hz samples of a 4 s breathing cycle (±40 Pa) with deterministic noise
+static void buildTrace() {
+  srand(1);
+  for (int i = 0; i < TRACE_LENGTH; i++) {
+    float t = i / (float)SENSOR_SAMPLE_RATE_HZ;
+    float noise = ((rand() / (float)RAND_MAX) - 0.5f) * 2.0f;
+    trace[i] = sin(t * TWO_PI / 4.0f) * 40.0f + noise;
+  }
+}
+
+// ========================================
+// Benchmark Runner
+// ========================================
+static const int RUNS = 5;
+static float budgetScale = 1.0f;
+static int failures = 0;
+
+// Time ops iterations of body(i); best of RUNS, in ns per op
+template<typename Body>
+static double measure(long ops, Body body) {
+  double best = 1e30;
+  for (int run = 0; run < RUNS; run++) {
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < ops; i++) {
+      body(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+    if (ns < best) best = ns;
+  }
+  return best;
+}
+
+// Behavior check alongside the timings (value against a limit, lower passes)
+static void check(const char* name, const char* unit, double value, double limit) {
+  bool pass = value <= limit;
+  if (!pass) failures++;
+  printf("  %-28s %10.2f %10.2f  %-10s %14s  %s\n", name, value, limit, unit, "", pass ? "PASS" : "FAIL");
+}
+
+static void report(const char* name, const char* unit, double ns, double budgetNs) {
+  double budget = budgetNs * budgetScale;
+  bool pass = ns <= budget;
+  if (!pass) failures++;
+  printf("  %-28s %10.2f %10.2f  %-10s %12.0f/s  %s\n", name, ns, budget, unit,
+         1e9 / ns, pass ? "PASS" : "FAIL");
+}
+
+// ========================================
+// Cases
+// ========================================
+
+// Full detection path: filter, normalization, state machine
+static void benchDetect() {
+  breathData.init();
+  double ns = measure(1000000, [](long i) {
+    breathData.detect(trace[i & (TRACE_LENGTH - 1)], (unsigned long)(i * 10));
+  });
+  sink = breathData.getBreathCount();
+  report("BreathData::detect", "ns/sample", ns, 250);
+}
+
+// Bounds tracking with a breath amplitude that keeps changing: samples push
+// past the bounds and every phase end moves them to the peak percentile
+static void benchNormalization() {
+  breathData.init();
+  double ns = measure(1000000, [](long i) {
+    float grow = 1.0f + ((i >> 9) & 63) * 0.05f;
+    breathData.detect(trace[i & (TRACE_LENGTH - 1)] * grow, (unsigned long)(i * 10));
+  });
+  sink = (uint32_t)breathData.getMaxDelta();
+  report("normalization update", "ns/sample", ns, 250);
+}
+
+static void benchFilter() {
+  static BreathSignalFilter filter;
+  double ns = measure(1000000, [](long i) {
+    sink = (uint32_t)filter.process(trace[i & (TRACE_LENGTH - 1)]);
+  });
+  report("BreathSignalFilter", "ns/sample", ns, 100);
+}
+
+static void benchBaseline() {
+  static BaselineTracker tracker;
+  tracker.reset(SENSOR_SAMPLE_RATE_HZ);
+  double ns = measure(1000000, [](long i) {
+    tracker.update(101325.0f + trace[i & (TRACE_LENGTH - 1)], (i & 1) != 0);
+  });
+  sink = (uint32_t)tracker.getBaseline();
+  report("BaselineTracker::update", "ns/sample", ns, 50);
+}
+
+// Warm-up taken mid-exhale (+20 Pa), then the user stops breathing: the
+// delta sits past the inhale threshold, so the baseline must recover
+// without ever seeing idle. Checks the seconds until detection stays quiet
+// and the baseline error at the end.
+static void checkBaselineRecovery() {
+  static BaselineTracker tracker;
+  tracker.reset(SENSOR_SAMPLE_RATE_HZ);
+  breathData.init();
+
+  const float ambient = 101325.0f;
+  const int durationS = 40;
+  int quietSince = -1;
+  srand(2);
+  for (int i = 0; i < durationS * SENSOR_SAMPLE_RATE_HZ; i++) {
+    float noise = ((rand() / (float)RAND_MAX) - 0.5f) * 1.0f;
+    float pressure = ambient + noise + (i < BASELINE_WARMUP_SAMPLES ? 20.0f : 0.0f);
+    if (tracker.hasSamples()) {
+      breathData.detect(pressure - tracker.getBaseline(), (unsigned long)(i * 1000 / SENSOR_SAMPLE_RATE_HZ));
+    }
+    tracker.update(pressure, breathData.isQuiescent());
+
+    if (!breathData.isQuiescent()) {
+      quietSince = -1;
+    } else if (quietSince < 0) {
+      quietSince = i;
+    }
+  }
+
+  float recoveredS = quietSince < 0 ? durationS : (float)quietSince / SENSOR_SAMPLE_RATE_HZ;
+  check("baseline recovery time", "s", recoveredS, BASELINE_STUCK_TIME_S + 5 * BASELINE_RECOVER_TIME_S);
+  check("baseline recovery error", "Pa", fabsf(tracker.getBaseline() - ambient), 1.0);
+}
+
+// Spawn to capacity, remove from the middle, respawn: counts live-set
+// errors (duplicate, stale or missing ids, spawn past capacity)
+static void checkEntityPool() {
+  static const uint16_t CAPACITY = 16;
+  static EntityPool<CAPACITY> pool;
+  bool spawned[CAPACITY] = {};
+  int errors = 0;
+
+  for (uint16_t i = 0; i < CAPACITY; i++) {
+    uint16_t id = pool.spawn();
+    if (id >= CAPACITY || spawned[id]) errors++;
+    else spawned[id] = true;
+  }
+  if (pool.spawn() != EntityPool<CAPACITY>::INVALID) errors++;
+
+  // Every third id, so most removals swap a live id into the hole
+  int removed = 0;
+  for (uint16_t id = 1; id < CAPACITY; id += 3) {
+    pool.remove(id);
+    spawned[id] = false;
+    removed++;
+  }
+
+  // The dense list holds exactly the ids still spawned
+  bool seen[CAPACITY] = {};
+  if (pool.count() != CAPACITY - removed) errors++;
+  for (uint16_t j = 0; j < pool.count(); j++) {
+    uint16_t id = pool[j];
+    if (id >= CAPACITY || !spawned[id] || seen[id] || !pool.isActive(id)) errors++;
+    else seen[id] = true;
+  }
+  for (uint16_t id = 0; id < CAPACITY; id++) {
+    if (pool.isActive(id) != spawned[id]) errors++;
+  }
+
+  // Removed ids come back, then the pool is full again
+  for (int i = 0; i < removed; i++) {
+    uint16_t id = pool.spawn();
+    if (id >= CAPACITY || spawned[id]) errors++;
+    else spawned[id] = true;
+  }
+  if (pool.spawn() != EntityPool<CAPACITY>::INVALID || !pool.isFull()) errors++;
+
+  check("EntityPool live set", "errors", errors, 0);
+}
+
+// Encode a stream with gaps, steps and sign changes, decode it and count
+// samples that do not come back at the format's 0.01 resolution
+static void checkRecordingCodec() {
+  static const int SAMPLES = 2000;
+  static uint8_t stream[BREATH_RECORD_HEADER_SIZE + SAMPLES * BREATH_RECORD_MAX_SAMPLE_SIZE];
+  static PressureSample input[SAMPLES];
+  BreathRecordCodec encoder;
+  size_t used = BreathRecordCodec::writeHeader(stream, SENSOR_SAMPLE_RATE_HZ);
+
+  uint32_t timestampMs = 12345;
+  for (int i = 0; i < SAMPLES; i++) {
+    timestampMs += (i % 500 == 499) ? 70000 : 10 + (i & 1);
+    float step = (i / 250) % 2 ? -900.0f : 0.0f;
+    input[i].timestampMs = timestampMs;
+    input[i].pressure = 101325.0f + step + trace[i & (TRACE_LENGTH - 1)];
+    input[i].temperature = 22.0f - (i % 300) * 0.37f;
+    used += encoder.encode(input[i], stream + used);
+  }
+
+  int mismatches = 0;
+  uint16_t rateHz = 0;
+  if (!BreathRecordCodec::readHeader(stream, used, rateHz) || rateHz != SENSOR_SAMPLE_RATE_HZ) {
+    mismatches++;
+  }
+
+  BreathRecordCodec decoder;
+  size_t offset = BREATH_RECORD_HEADER_SIZE;
+  for (int i = 0; i < SAMPLES; i++) {
+    PressureSample sample;
+    size_t n = decoder.decode(stream + offset, used - offset, sample);
+    if (n == 0) {
+      mismatches += SAMPLES - i;
+      break;
+    }
+    offset += n;
+    if (sample.timestampMs != input[i].timestampMs ||
+        fabsf(sample.pressure - input[i].pressure) > 0.01f ||
+        fabsf(sample.temperature - input[i].temperature) > 0.01f) {
+      mismatches++;
+    }
+  }
+  if (offset != used) mismatches++;
+
+  check("recording round trip", "mismatches", mismatches, 0);
+}
+
+// Sampling task to main loop hand-off
+static void benchRingBuffer() {
+  static RingBuffer<PressureSample, SENSOR_QUEUE_SIZE> ring;
+  double ns = measure(1000000, [](long i) {
+    PressureSample sample = { (uint32_t)i, trace[i & (TRACE_LENGTH - 1)], 22.0f };
+    ring.push(sample);
+    if (ring.pop(sample)) {
+      sink = sample.timestampMs;
+    }
+  });
+  report("RingBuffer push+pop", "ns/sample", ns, 100);
+}
+
+// Frame-sized batch of color conversions
+static void benchRgb565() {
+  static const int PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT;
+  static uint16_t pixels[PIXELS];
+  double ns = measure(200, [](long frame) {
+    for (int i = 0; i < PIXELS; i++) {
+      pixels[i] = rgb565((uint8_t)(i + frame), (uint8_t)(i >> 7), (uint8_t)(i >> 3));
+    }
+    sink = pixels[frame & (PIXELS - 1)];
+  });
+  report("rgb565 (per pixel)", "ns/pixel", ns / PIXELS, 5);
+}
+
+// Frame-sized batch of canvas-order alpha blends
+static void benchBlend565() {
+  static const int PIXELS = SCREEN_WIDTH * SCREEN_HEIGHT;
+  static uint16_t pixels[PIXELS];
+  double ns = measure(200, [](long frame) {
+    for (int i = 0; i < PIXELS; i++) {
+      pixels[i] = blendSwapped565((uint16_t)(i * 40503u), pixels[i], (uint8_t)((i + frame) & 31));
+    }
+    sink = pixels[frame & (PIXELS - 1)];
+  });
+  report("blendSwapped565 (per pixel)", "ns/pixel", ns / PIXELS, 5);
+}
+
+static uint16_t swapBytes(uint16_t c) {
+  return (uint16_t)((c >> 8) | (c << 8));
+}
+
+// Per-channel reference for blend565
+static uint16_t blendReference(uint16_t fg, uint16_t bg, int alpha) {
+  int r = (((fg >> 11) & 31) * alpha + ((bg >> 11) & 31) * (32 - alpha)) >> 5;
+  int g = (((fg >> 5) & 63) * alpha + ((bg >> 5) & 63) * (32 - alpha)) >> 5;
+  int b = ((fg & 31) * alpha + (bg & 31) * (32 - alpha)) >> 5;
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// The SWAR blend must match the per-channel reference exactly: a sampled
+// fg/bg grid (prime stride, so every channel sees many values) at every alpha
+static void checkBlend565() {
+  int mismatches = 0;
+  for (uint32_t fg = 0; fg < 0x10000; fg += 251) {
+    for (uint32_t bg = 0; bg < 0x10000; bg += 241) {
+      for (int alpha = 0; alpha <= ALPHA_OPAQUE; alpha++) {
+        uint16_t c = swapBytes(blendSwapped565(swapBytes((uint16_t)fg), swapBytes((uint16_t)bg), (uint8_t)alpha));
+        if (c != blendReference((uint16_t)fg, (uint16_t)bg, alpha)) mismatches++;
+      }
+    }
+  }
+  check("blendSwapped565 vs reference", "mismatches", mismatches, 0);
+}
+
+static void benchRecordingCodec() {
+  static BreathRecordCodec encoder;
+  static BreathRecordCodec decoder;
+  double ns = measure(1000000, [](long i) {
+    uint8_t buffer[BREATH_RECORD_MAX_SAMPLE_SIZE];
+    PressureSample sample = { (uint32_t)(i * 10), 101325.0f + trace[i & (TRACE_LENGTH - 1)], 22.0f };
+    size_t n = encoder.encode(sample, buffer);
+    decoder.decode(buffer, n, sample);
+    sink = (uint32_t)sample.pressure;
+  });
+  report("recording encode+decode", "ns/sample", ns, 200);
+}
+
+static void benchHistogram() {
+  static PhaseHistogram histogram;
+  histogram.reset();
+  double ns = measure(1000000, [](long i) {
+    histogram.add((uint32_t)(i * 2654435761u) >> 14);
+  });
+  sink = histogram.getMax();
+  report("PhaseHistogram::add", "ns/add", ns, 50);
+}
+
+static void benchDecayingQuantile() {
+  static BreathPeakQuantile peaks(1.0f, 2000.0f, NORM_PEAK_DECAY);
+  peaks.reset();
+  double ns = measure(1000000, [](long i) {
+    peaks.add(fabsf(trace[i & (TRACE_LENGTH - 1)]));
+  });
+  sink = peaks.getCount();
+  report("DecayingQuantile::add", "ns/add", ns, 100);
+
+  ns = measure(100000, [](long) {
+    sink = (uint32_t)peaks.quantile(NORM_PEAK_QUANTILE);
+  });
+  report("DecayingQuantile::quantile", "ns/query", ns, 1000);
+}
+
+// Spawn/expire churn plus a full SoA pass over the live entities
+static void benchEntityPool() {
+  static EntityPool<256> pool;
+  static float x[256];
+  double ns = measure(100000, [](long i) {
+    uint16_t id = pool.spawn();
+    if (id != EntityPool<256>::INVALID) {
+      x[id] = (float)(i & 255);
+    }
+    for (uint16_t j = 0; j < pool.count();) {
+      uint16_t live = pool[j];
+      x[live] -= 1.0f;
+      if (x[live] < 0) pool.remove(live); else j++;
+    }
+  });
+  sink = pool.count();
+  report("EntityPool update (~128 live)", "ns/frame", ns, 1000);
+}
+
+int main(int argc, char* argv[]) {
+  if (argc > 1) {
+    budgetScale = (float)atof(argv[1]);
+    if (budgetScale <= 0) {
+      fprintf(stderr, "Usage: %s [budget-scale]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  buildTrace();
+
+  printf("Core micro-benchmarks (best of %d runs, budget x%.2f)\n", RUNS, budgetScale);
+  printf("  %-28s %10s %10s  %-10s %14s\n", "case", "time", "budget", "unit", "throughput");
+  benchDetect();
+  benchNormalization();
+  benchFilter();
+  benchBaseline();
+  checkBaselineRecovery();
+  checkEntityPool();
+  checkRecordingCodec();
+  benchRingBuffer();
+  benchRgb565();
+  benchBlend565();
+  checkBlend565();
+  benchRecordingCodec();
+  benchHistogram();
+  benchDecayingQuantile();
+  benchEntityPool();
+
+  printf("%s: %d case(s) over budget\n", failures ? "FAIL" : "PASS", failures);
+  return failures ? 1 : 0;
+}
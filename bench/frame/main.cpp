@@ -0,0 +1,221 @@
+// Headless frame-time benchmark
+//
+// Renders game scenes into the offscreen canvas without SDL, runs N frames
+// as fast as possible on a virtual clock and reports per-frame update/draw
+// time percentiles.
+// There is no panel: the blit phase covers dirty-row detection plus a sleep
+// standing in for the SPI transfer of the pushed rows at DISPLAY_SPI_HZ. With
+// DISPLAY_ASYNC_BLIT that transfer overlaps the next frame's update/draw, so
+// compare the "frame" row between builds with DISPLAY_ASYNC_BLIT=0 and 1.
+//
+// The particles case stress-tests ParticleSystem alone: a few hundred live
+// particles over a static canvas, update and draw timed per frame.
+//
+// Usage: program [frames] [scene]
+//   frames: number of frames per scene (default 2000)
+//   scene:  balloon | live | particles | all (default all)
+
+#include "Platform.h"
+#include "config.h"
+#include "core/gfx/ParticleSystem.h"
+#include "core/hardware/BreathData.h"
+#include "core/hardware/Display.h"
+#include "core/util/Clock.h"
+#include "games/balloon/scenes/BalloonScene.h"
+#include "games/live_breath/scenes/LiveScene.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// ========================================
+// Global Application State
+// ========================================
+SerialMock Serial;
+
+BreathData breathData;
+Display display;
+
+// Scenes see time advance exactly one frame per iteration, independent of
+// how long the frame took to render
+static VirtualTimeSource virtualClock;
+
+// ========================================
+// Synthetic Breath Input
+// ========================================
+
+// Slow breathing cycle (4 s period, ±40 Pa) with a little deterministic jitter
+static float syntheticPressureDelta(float t) {
+  float breath = sin(t * TWO_PI / 4.0f) * 40.0f;
+  float jitter = ((rand() / (float)RAND_MAX) - 0.5f) * 2.0f;
+  return breath + jitter;
+}
+
+// ========================================
+// Timing Statistics
+// ========================================
+struct FrameStats {
+  std::vector<float> samples;  // microseconds
+
+  void add(float us) { samples.push_back(us); }
+
+  float percentile(float p) const {
+    if (samples.empty()) return 0;
+    size_t index = (size_t)(p * (samples.size() - 1) + 0.5f);
+    return samples[index];
+  }
+
+  void print(const char* label) {
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (float s : samples) sum += s;
+    float mean = samples.empty() ? 0 : (float)(sum / samples.size());
+    printf("  %-7s %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n", label,
+           samples.empty() ? 0 : samples.front(), mean,
+           percentile(0.50f), percentile(0.95f), percentile(0.99f),
+           samples.empty() ? 0 : samples.back());
+  }
+};
+
+static float elapsedUs(std::chrono::steady_clock::time_point start,
+                       std::chrono::steady_clock::time_point end) {
+  return std::chrono::duration<float, std::micro>(end - start).count();
+}
+
+// ========================================
+// Benchmark Runner
+// ========================================
+static void runScene(const char* name, SceneBase* scene, int frames) {
+  srand(1);
+  breathData.init();
+  scene->init();
+
+  FrameStats updateStats;
+  FrameStats drawStats;
+  FrameStats blitStats;
+  FrameStats frameStats;
+  updateStats.samples.reserve(frames);
+  drawStats.samples.reserve(frames);
+  blitStats.samples.reserve(frames);
+  frameStats.samples.reserve(frames);
+  long blitRows = 0;
+  display.invalidate();
+
+  // Advance simulated time by one scene frame per iteration
+  float dt = 1.0f / scene->getFps();
+
+  uint32_t startMs = virtualClock.millis();
+
+  for (int i = 0; i < frames; i++) {
+    uint32_t frameMs = startMs + (uint32_t)((int64_t)i * 1000 / scene->getFps());
+    virtualClock.advanceMs(frameMs - virtualClock.millis());
+    breathData.detect(syntheticPressureDelta(i * dt));
+
+    auto t0 = std::chrono::steady_clock::now();
+    scene->update(dt);
+    auto t1 = std::chrono::steady_clock::now();
+    scene->draw(display.getCanvas());
+    auto t2 = std::chrono::steady_clock::now();
+    display.blit();
+    auto t3 = std::chrono::steady_clock::now();
+
+    updateStats.add(elapsedUs(t0, t1));
+    drawStats.add(elapsedUs(t1, t2));
+    blitStats.add(elapsedUs(t2, t3));
+    frameStats.add(elapsedUs(t0, t3));
+    blitRows += display.getLastBlitRows();
+  }
+
+  display.waitBlit();
+
+  printf("%s (%d frames @ %d FPS target, %s blit, times in us)\n", name, frames,
+         scene->getFps(), DISPLAY_ASYNC_BLIT ? "async" : "blocking");
+  printf("  %-7s %9s %9s %9s %9s %9s %9s\n", "phase", "min", "mean", "p50", "p95", "p99", "max");
+  updateStats.print("update");
+  drawStats.print("draw");
+  blitStats.print("blit");
+  frameStats.print("frame");
+  printf("  rows pushed per frame: %.1f / %d\n\n", (float)blitRows / frames, SCREEN_HEIGHT);
+}
+
+// Steady state of ~PARTICLE_STRESS_LIVE particles: bursts every frame
+static const uint16_t PARTICLE_STRESS_CAPACITY = 512;
+static const int PARTICLE_STRESS_LIVE = 300;
+
+static void runParticles(int frames) {
+  static ParticleSystem<PARTICLE_STRESS_CAPACITY> particles(64, PARTICLE_STRESS_CAPACITY);
+  particles.clear();
+  particles.setGravity(60.0f);
+  Canvas& canvas = display.getCanvas();
+  canvas.fillScreen(0);
+
+  const uint16_t lifeMs = 1000;
+  const float dt = 1.0f / 50;
+  const int perFrame = PARTICLE_STRESS_LIVE * 20 / lifeMs;  // live = rate * life
+
+  FrameStats updateStats;
+  FrameStats drawStats;
+  long live = 0;
+
+  for (int i = 0; i < frames; i++) {
+    auto t0 = std::chrono::steady_clock::now();
+    particles.burst((float)(i * 7 % SCREEN_WIDTH), (float)(i * 13 % SCREEN_HEIGHT), perFrame, 40.0f,
+                    lifeMs, 0xFFFF, 2);
+    particles.update(dt);
+    auto t1 = std::chrono::steady_clock::now();
+    particles.draw(canvas);
+    auto t2 = std::chrono::steady_clock::now();
+
+    updateStats.add(elapsedUs(t0, t1));
+    drawStats.add(elapsedUs(t1, t2));
+    live += particles.count();
+  }
+
+  printf("ParticleSystem (%d frames, %.0f live on average, 2x2 blended, times in us)\n", frames,
+         (float)live / frames);
+  printf("  %-7s %9s %9s %9s %9s %9s %9s\n", "phase", "min", "mean", "p50", "p95", "p99", "max");
+  updateStats.print("update");
+  drawStats.print("draw");
+  printf("\n");
+}
+
+int main(int argc, char* argv[]) {
+  int frames = argc > 1 ? atoi(argv[1]) : 2000;
+  const char* which = argc > 2 ? argv[2] : "all";
+  if (frames <= 0) {
+    fprintf(stderr, "Usage: %s [frames] [balloon|live|particles|all]\n", argv[0]);
+    return 1;
+  }
+
+  Clock::setSource(&virtualClock);
+  display.init();
+
+  bool all = strcmp(which, "all") == 0;
+  bool ran = false;
+
+  if (all || strcmp(which, "balloon") == 0) {
+    BalloonScene* scene = new BalloonScene();
+    runScene("BalloonScene", scene, frames);
+    delete scene;
+    ran = true;
+  }
+
+  if (all || strcmp(which, "live") == 0) {
+    LiveScene* scene = new LiveScene();
+    runScene("LiveScene", scene, frames);
+    delete scene;
+    ran = true;
+  }
+
+  if (all || strcmp(which, "particles") == 0) {
+    runParticles(frames);
+    ran = true;
+  }
+
+  if (!ran) {
+    fprintf(stderr, "Unknown scene '%s' (expected balloon, live, particles or all)\n", which);
+    return 1;
+  }
+  return 0;
+}
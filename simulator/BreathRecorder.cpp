@@ -0,0 +1,37 @@
+// Simulator file backend for BreathRecorder (plain file)
+#include "core/hardware/BreathRecorder.h"
+#include "Platform.h"
+
+#include <stdlib.h>
+
+extern SerialMock Serial;
+
+// The path in SPIRO_RECORD; recording is off when it is unset
+bool BreathRecorder::openFile() {
+  const char* path = getenv("SPIRO_RECORD");
+  if (!path || !*path) {
+    return false;
+  }
+
+  _file = fopen(path, "wb");
+  if (!_file) {
+    Serial.print("Session recording disabled: cannot open ");
+    Serial.println(path);
+    return false;
+  }
+
+  Serial.print("Recording session to ");
+  Serial.println(path);
+  return true;
+}
+
+size_t BreathRecorder::writeFile(const uint8_t* data, size_t length) {
+  size_t written = fwrite(data, 1, length, _file);
+  fflush(_file);
+  return written;
+}
+
+void BreathRecorder::closeFile() {
+  fclose(_file);
+  _file = nullptr;
+}
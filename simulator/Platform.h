@@ -8,7 +8,12 @@
 #include <cstring>
 #include <algorithm>
 #include <iostream>
-#include <SDL2/SDL.h>
+#include <chrono>
+#ifdef HEADLESS
+  #include <thread>
+#else
+  #include <SDL2/SDL.h>
+#endif
 
 // Arduino types
 using uint8_t = std::uint8_t;
@@ -18,6 +23,18 @@ using int8_t = std::int8_t;
 using int16_t = std::int16_t;
 using int32_t = std::int32_t;
 
+#ifdef HEADLESS
+// Arduino timing (steady clock, no SDL)
+inline uint32_t millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
+
+inline void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+#else
 // Arduino timing (uses SDL)
 inline uint32_t millis() {
   return SDL_GetTicks();
@@ -26,6 +43,14 @@ inline uint32_t millis() {
 inline void delay(uint32_t ms) {
   SDL_Delay(ms);
 }
+#endif
+
+// Microsecond timer for profiling (steady clock; only differences matter)
+inline uint32_t micros() {
+  static const auto start = std::chrono::steady_clock::now();
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+    std::chrono::steady_clock::now() - start).count();
+}
 
 // Arduino math
 #ifndef TWO_PI
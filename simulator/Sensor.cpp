@@ -1,38 +1,60 @@
 // Simulator implementation of Sensor
 #include "core/hardware/Sensor.h"
-#include "core/hardware/Display.h"
+#include "core/util/Clock.h"
 #include "Platform.h"
 #include "config.h"
 
+#if LATENCY_PROBE
+  #include "core/perf/LatencyProbe.h"
+#endif
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
 extern SerialMock Serial;
 
+static const float SIM_AMBIENT_PRESSURE = 101325.0f;  // Standard atmospheric pressure (Pa)
+
 void Sensor::init() {
+  const char* replayPath = getenv("SPIRO_REPLAY");
+  if (replayPath && *replayPath && loadReplay(replayPath)) {
+    currentPressure = SIM_AMBIENT_PRESSURE;
+    currentTemperature = 22.0f;
+    return;
+  }
+
+  const char* stepPeriod = getenv("SPIRO_STEP");
+  if (stepPeriod && atoi(stepPeriod) > 0) {
+    _stepPeriodMs = (uint32_t)atoi(stepPeriod);
+    Serial.print("Step input: 0 / ");
+    Serial.print(LATENCY_STEP_PA);
+    Serial.print(" Pa every ");
+    Serial.print((int)_stepPeriodMs);
+    Serial.println(" ms, mouse input disabled");
+    currentPressure = SIM_AMBIENT_PRESSURE;
+    currentTemperature = 22.0f;
+    return;
+  }
+
   Serial.println("Initializing simulated sensor...");
   Serial.println("Use mouse Y position (screen-relative) to simulate breath pressure");
   Serial.println("  - Move mouse UP = Exhale (positive pressure)");
   Serial.println("  - Move mouse DOWN = Inhale (negative pressure)");
   Serial.println("  - Screen center = Neutral");
+  Serial.println("  - Baseline calibrates from the first samples: start near center");
   Serial.println("Simulated sensor initialized!");
 
-  baselinePressure = 101325.0f;  // Standard atmospheric pressure (Pa)
-  currentPressure = 101325.0f;
+  currentPressure = SIM_AMBIENT_PRESSURE;
   currentTemperature = 22.0f;    // Room temperature (C)
 }
 
-void Sensor::calibrateBaseline() {
-  Serial.println("Calibrating baseline (simulated)...");
-  display.showMessage("Calibrating...\n  Move mouse\n  to center", TFT_CYAN);
-  delay(1000);
-  display.clear();
-  Serial.println("Baseline calibrated (simulated)");
-}
-
 void Sensor::setMouseY(int mouseY, int windowHeight) {
   _mouseY = mouseY;
   _windowHeight = windowHeight;
 }
 
-void Sensor::update() {
+void Sensor::updateMouseInput() {
   // Get global mouse position (absolute screen coordinates)
   int globalMouseY;
   SDL_GetGlobalMouseState(nullptr, &globalMouseY);
@@ -51,8 +73,167 @@ void Sensor::update() {
 
   // Scale to pressure range (±50 Pa is typical breath range)
   // Negate so up = exhale (positive), down = inhale (negative)
-  pressureDelta = -normalizedY * 50.0f;
+  _mousePressureDelta.store(-normalizedY * 50.0f);
+}
+
+Sensor::~Sensor() {
+  _samplingRunning = false;
+  if (_samplingThread.joinable()) {
+    _samplingThread.join();
+  }
+}
+
+bool Sensor::loadReplay(const char* path) {
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    Serial.print("Cannot open replay file ");
+    Serial.println(path);
+    return false;
+  }
+
+  std::vector<uint8_t> data;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    data.insert(data.end(), chunk, chunk + n);
+  }
+  fclose(file);
+
+  uint16_t rateHz;
+  if (!BreathRecordCodec::readHeader(data.data(), data.size(), rateHz) || rateHz == 0) {
+    Serial.print("Not a breath recording: ");
+    Serial.println(path);
+    return false;
+  }
+
+  _replayData.swap(data);
+  _replayRateHz = rateHz;
+
+  Serial.print("Replaying ");
+  Serial.print(path);
+  Serial.print(" (");
+  Serial.print(rateHz);
+  Serial.println(" Hz), mouse input disabled");
+  return true;
+}
+
+void Sensor::startSampling(int rateHz) {
+  if (isReplaying()) {
+    // Baseline tracking must match the recorded rate
+    rateHz = _replayRateHz;
+  }
+  _sampleRateHz = rateHz;
+  _baseline.reset(rateHz);
+  if (!isReplaying()) {
+    updateMouseInput();
+  }
+
+  _stepStartMs = Clock::millis();
+
+  Serial.print(isReplaying() ? "Starting replay at " : "Starting sensor sampling thread at ");
+  Serial.print(rateHz);
+  Serial.println(" Hz");
+
+  if (isReplaying()) {
+    // Replay offsets count from here
+    _replayStartMs = Clock::millis();
+    _replayOffset = BREATH_RECORD_HEADER_SIZE;
+    _replayCodec.reset();
+    return;
+  }
+
+  _samplingRunning = true;
+  _samplingThread = std::thread(&Sensor::samplingLoop, this);
+}
+
+void Sensor::samplingLoop() {
+  const auto period = std::chrono::microseconds(1000000 / _sampleRateHz);
+  auto nextWake = std::chrono::steady_clock::now();
+
+  while (_samplingRunning) {
+    PressureSample sample;
+    sample.timestampMs = Clock::millis();
+    sample.pressure = SIM_AMBIENT_PRESSURE +
+      (_stepPeriodMs ? stepLevel(sample.timestampMs) * LATENCY_STEP_PA : _mousePressureDelta.load());
+    sample.temperature = 22.0f;
+    _samples.push(sample);
+
+    // Fixed-rate schedule, like vTaskDelayUntil on the device
+    nextWake += period;
+    std::this_thread::sleep_until(nextWake);
+  }
+}
+
+int Sensor::stepLevel(uint32_t timestampMs) const {
+  uint32_t steps = (timestampMs - _stepStartMs) / _stepPeriodMs;
+  if (steps > LATENCY_STEP_COUNT) {
+    steps = LATENCY_STEP_COUNT;
+  }
+  return steps & 1;
+}
+
+bool Sensor::pollReplay(PressureSample& sample) {
+  if (!_replayHasNext) {
+    size_t used = _replayCodec.decode(_replayData.data() + _replayOffset,
+                                      _replayData.size() - _replayOffset, _replayNext);
+    if (used == 0) {
+      if (!_replayFinished) {
+        _replayFinished = true;
+        Serial.println("Replay finished");
+      }
+      return false;
+    }
+    _replayOffset += used;
+    _replayHasNext = true;
+
+    if (!_replayStarted) {
+      _replayFirstTimestamp = _replayNext.timestampMs;
+      _replayStarted = true;
+    }
+    // Rebase onto the current clock, keeping the recorded spacing exactly
+    _replayNext.timestampMs = _replayStartMs + (_replayNext.timestampMs - _replayFirstTimestamp);
+  }
+
+  // Not yet due
+  if ((int32_t)(Clock::millis() - _replayNext.timestampMs) < 0) {
+    return false;
+  }
+
+  sample = _replayNext;
+  _replayHasNext = false;
+  return true;
+}
+
+bool Sensor::poll() {
+  PressureSample sample;
+  if (isReplaying()) {
+    if (!pollReplay(sample)) {
+      return false;
+    }
+  } else if (!_samples.pop(sample)) {
+    // Queue drained for this frame: refresh the input for the next samples
+    updateMouseInput();
+    return false;
+  }
+
+  if (_stepPeriodMs) {
+    int level = stepLevel(sample.timestampMs);
+    if (level != _stepLevel) {
+      _stepLevel = level;
+#if LATENCY_PROBE
+      latencyProbe.markStep(sample.timestampMs);
+#endif
+    }
+    // One more period after the last step for it to show
+    if (sample.timestampMs - _stepStartMs >= (LATENCY_STEP_COUNT + 1) * _stepPeriodMs) {
+      _stepFinished = true;
+    }
+  }
 
-  // Update absolute pressure for display
-  currentPressure = baselinePressure + pressureDelta;
+  sampleTime = sample.timestampMs;
+  currentPressure = sample.pressure;
+  currentTemperature = sample.temperature;
+  // The very first sample defines the provisional baseline
+  pressureDelta = _baseline.hasSamples() ? currentPressure - _baseline.getBaseline() : 0;
+  return true;
 }
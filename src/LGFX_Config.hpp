@@ -3,7 +3,7 @@
 #define LGFX_USE_V1
 #include <LovyanGFX.hpp>
 
-#ifdef SIMULATOR
+#if defined(SIMULATOR) && !defined(HEADLESS)
   #include <lgfx/v1/platforms/sdl/Panel_sdl.hpp>
 #endif
 
@@ -12,7 +12,9 @@
 class LGFX : public lgfx::LGFX_Device {
 public:
   LGFX() {
-#ifdef SIMULATOR
+#if defined(HEADLESS)
+    // Headless build: no panel, scenes only render into offscreen sprites
+#elif defined(SIMULATOR)
     // SDL2 panel for desktop simulator
     auto panel = new lgfx::Panel_sdl();
     auto cfg = panel->config();
@@ -31,12 +33,13 @@ public:
       auto cfg = bus->config();
       cfg.spi_host = VSPI_HOST;
       cfg.spi_mode = 0;
-      cfg.freq_write = 27000000;
+      cfg.freq_write = DISPLAY_SPI_HZ;
       cfg.freq_read  = 16000000;
       cfg.pin_sclk = TFT_SCLK;
       cfg.pin_mosi = TFT_MOSI;
       cfg.pin_miso = -1;
       cfg.pin_dc   = TFT_DC;
+      cfg.dma_channel = SPI_DMA_CH_AUTO;  // Used by asynchronous blits
       bus->config(cfg);
     }
 
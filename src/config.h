@@ -26,6 +26,14 @@
 // ========================================
 #define SCREEN_WIDTH  128
 #define SCREEN_HEIGHT 128
+#define DISPLAY_SPI_HZ 27000000
+
+// Double-buffered display: blit() starts an asynchronous push of the finished
+// canvas (DMA on ESP32, worker thread in the simulator) and the scene draws
+// the next frame into the other canvas. Set to 0 for blocking blits.
+#ifndef DISPLAY_ASYNC_BLIT
+#define DISPLAY_ASYNC_BLIT 1
+#endif
 
 // Custom color definitions (not in all ST7735 library versions)
 #define ST77XX_GRAY   0x8410  // RGB(128, 128, 128)
@@ -49,20 +57,96 @@ enum BreathState {
   BREATH_HOLD
 };
 
+// Breath state transitions, queued by BreathData at sample time
+enum BreathEventType {
+  BREATH_EVENT_INHALE_START,
+  BREATH_EVENT_INHALE_END,
+  BREATH_EVENT_EXHALE_START,
+  BREATH_EVENT_EXHALE_END,
+  BREATH_EVENT_HOLD_START,
+  BREATH_EVENT_HOLD_END,
+  BREATH_EVENT_CYCLE_COMPLETE  // An exhale ended after an inhale (one breath)
+};
+
 // Default calibration thresholds (Pa)
 #define DEFAULT_INHALE_THRESHOLD  -5.0f
 #define DEFAULT_EXHALE_THRESHOLD   5.0f
 #define BREATH_HOLD_TIMEOUT_MS     3000
 #define BREATH_HOLD_STABILITY_PA   2.0f
+#define BREATH_HYSTERESIS_PA       2.0f   // Inhale/exhale end this far inside their threshold
+#define BREATH_EVENT_QUEUE_SIZE    16     // Event ring capacity (power of two)
+
+// Online baseline calibration (no blocking calibration at boot)
+#define BASELINE_WARMUP_SAMPLES    50     // Running mean of the first samples (~0.5 s)
+#define BASELINE_TRACK_TIME_S      10.0f  // Drift tracking time constant while idle/hold
+#define BASELINE_STUCK_TIME_S      12.0f  // Longer without idle/hold: baseline is off
+#define BASELINE_RECOVER_TIME_S    1.0f   // Tracking time constant while recovering
 
 // Normalization overage threshold (1.1 = 10% beyond bounds before expanding)
 #define NORM_OVERAGE_THRESHOLD     1.25f
 
+// Adaptive normalization bounds from recent inhale/exhale peaks (Pa)
+#define NORM_MIN_BOUND_PA          10.0f  // Initial and smallest bound
+#define NORM_PEAK_QUANTILE         0.8f   // Peak percentile that reaches the overage
+#define NORM_PEAK_DECAY            0.95f  // Per-peak weight decay (~20 recent peaks)
+#define NORM_PEAK_MIN_COUNT        3      // Peaks per phase before bounds can contract
+#define NORM_PEAK_BUCKETS          48     // Log-spaced histogram buckets over 1..2000 Pa
+
+// Normalized breath prediction (scene look-ahead, see SceneBase)
+#define BREATH_PREDICT_MAX_MS      100    // Extrapolation horizon cap
+
+// Breath analytics sliding window (recent cycles)
+#define BREATH_ANALYTICS_WINDOW_MS   60000  // Cycles older than this drop out
+#define BREATH_ANALYTICS_MAX_CYCLES  32     // Ring capacity (also caps the window)
+#define BREATH_ANALYTICS_MAX_CYCLE_MS 20000 // Longer "cycles" are pauses, not breaths
+
 // ========================================
 // Update Rates
 // ========================================
 #define MAIN_LOOP_DELAY_MS        20    // ~50Hz
+#define SENSOR_SAMPLE_RATE_HZ     100   // Background sampling task rate (100-200)
+#define SENSOR_QUEUE_SIZE         64    // Queued samples (power of two)
+#define SENSOR_TASK_CORE          0     // ESP32: Arduino loop() runs on core 1
+#define PROFILER_DUMP_INTERVAL_MS 5000  // Serial frame timing summary (0 = off)
 #define WAVE_UPDATE_FPS           30
 #define DIAGNOSTIC_UPDATE_FPS     10
 
+// ========================================
+// Diagnostics
+// ========================================
+// DiagnosticScene: simulator keys D (switch scene), P and B (overlays).
+// The device has no input, so these pick what it shows from boot.
+#ifndef DIAGNOSTIC_AT_BOOT
+#define DIAGNOSTIC_AT_BOOT               0   // Start in DiagnosticScene instead of the game
+#endif
+#ifndef DIAGNOSTIC_PROFILER_OVERLAY
+#define DIAGNOSTIC_PROFILER_OVERLAY      0   // Per-phase frame timings
+#endif
+#ifndef DIAGNOSTIC_BREATH_STATS_OVERLAY
+#define DIAGNOSTIC_BREATH_STATS_OVERLAY  0   // Breath analytics
+#endif
+
+// ========================================
+// Session Recording
+// ========================================
+// Device: stream every sensor sample to SPIFFS (simulator: set SPIRO_RECORD)
+#ifndef SESSION_RECORDING
+#define SESSION_RECORDING         0
+#endif
+#define SESSION_RECORD_PATH       "/session.brec"
+#define SESSION_RECORD_FLUSH_MS   1000  // Write buffered samples out this often
+#define SESSION_RECORD_MAX_S      600   // Device: end (close) the recording after this (0 = never)
+
+// ========================================
+// Latency Probe
+// ========================================
+// Tag scene frames with their input sample time and report sample-to-panel
+// latency over serial (simulator: SPIRO_STEP=<ms> drives a square-wave input)
+#ifndef LATENCY_PROBE
+#define LATENCY_PROBE             0
+#endif
+#define LATENCY_STEP_RESPONSE     0.5f  // Input change (normalized) that answers a step
+#define LATENCY_STEP_PA           40.0f // Simulator step input amplitude
+#define LATENCY_STEP_COUNT        20    // Simulator steps before the report and exit
+
 #endif // CONFIG_H
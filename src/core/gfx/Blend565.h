@@ -0,0 +1,43 @@
+#ifndef BLEND565_H
+#define BLEND565_H
+
+#include <stdint.h>
+
+// RGB565 alpha blending with 5-bit alpha (0 = background, 32 = foreground).
+//
+// SWAR: a pixel is spread over 32 bits as 00000gggggg00000rrrrr000000bbbbb
+// (mask 0x07E0F81F), leaving room above each channel so all three are
+// scaled by one multiply and one shift.
+
+static const uint8_t ALPHA_OPAQUE = 32;
+
+// Spread an RGB565 pixel into the 0x07E0F81F layout
+inline uint32_t spread565(uint16_t c) {
+  return ((uint32_t)c | ((uint32_t)c << 16)) & 0x07E0F81Fu;
+}
+
+// Fold a 0x07E0F81F layout back into RGB565
+inline uint16_t fold565(uint32_t x) {
+  x &= 0x07E0F81Fu;
+  return (uint16_t)(x | (x >> 16));
+}
+
+// fg over bg, both RGB565
+inline uint16_t blend565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  uint32_t b = spread565(bg);
+  uint32_t f = spread565(fg);
+  return fold565(((((f - b) * alpha) >> 5) + b));
+}
+
+// fg over bg, both in canvas byte order (swap565)
+inline uint16_t blendSwapped565(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  uint16_t c = blend565((uint16_t)((fg >> 8) | (fg << 8)), (uint16_t)((bg >> 8) | (bg << 8)), alpha);
+  return (uint16_t)((c >> 8) | (c << 8));
+}
+
+// Combine two 0..32 alphas
+inline uint8_t mulAlpha(uint8_t a, uint8_t b) {
+  return (uint8_t)((a * b + 16) >> 5);
+}
+
+#endif // BLEND565_H
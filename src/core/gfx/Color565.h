@@ -0,0 +1,23 @@
+#ifndef COLOR565_H
+#define COLOR565_H
+
+#include <stdint.h>
+
+// Pure RGB565 helpers (no display dependency, usable from native tests)
+
+// Pack 8-bit RGB into RGB565
+inline constexpr uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+  return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+}
+
+// Pack 0xRRGGBB into RGB565
+inline constexpr uint16_t rgb565(uint32_t rgb) {
+  return rgb565((uint8_t)(rgb >> 16), (uint8_t)(rgb >> 8), (uint8_t)rgb);
+}
+
+// Byte-swap an RGB565 value to the order canvas buffers store pixels in
+inline constexpr uint16_t swap565(uint16_t color) {
+  return (uint16_t)((color >> 8) | (color << 8));
+}
+
+#endif // COLOR565_H
@@ -0,0 +1,30 @@
+#include "IndexedSprite.h"
+
+void drawIndexedSprite(Canvas& canvas, int x, int y, const IndexedSprite& sprite, const uint16_t palette[4]) {
+  const int canvasWidth = canvas.width();
+  const int canvasHeight = canvas.height();
+
+  // Clip to the canvas
+  int x0 = x < 0 ? -x : 0;
+  int y0 = y < 0 ? -y : 0;
+  int x1 = sprite.width;
+  int y1 = sprite.height;
+  if (x + x1 > canvasWidth) x1 = canvasWidth - x;
+  if (y + y1 > canvasHeight) y1 = canvasHeight - y;
+  if (x0 >= x1 || y0 >= y1) return;
+
+  // Writing the canvas buffer directly skips per-pixel clipping/conversion
+  uint16_t* buffer = (uint16_t*)canvas.getBuffer();
+  const int stride = (sprite.width + 3) >> 2;
+
+  for (int sy = y0; sy < y1; sy++) {
+    const uint8_t* src = sprite.pixels + sy * stride;
+    uint16_t* dst = buffer + (y + sy) * canvasWidth + x;
+    for (int sx = x0; sx < x1; sx++) {
+      int index = (src[sx >> 2] >> (6 - ((sx & 3) << 1))) & 3;
+      if (index) {
+        dst[sx] = palette[index];
+      }
+    }
+  }
+}
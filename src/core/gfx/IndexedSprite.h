@@ -0,0 +1,18 @@
+#ifndef INDEXED_SPRITE_H
+#define INDEXED_SPRITE_H
+
+#include "core/hardware/Display.h"
+
+// 2-bit palette sprite stored in flash: 4 pixels per byte, first pixel in
+// the high bits, each row padded to a whole byte. Index 0 is transparent.
+struct IndexedSprite {
+  int16_t width;
+  int16_t height;
+  const uint8_t* pixels;
+};
+
+// Draw with top-left at (x, y), clipped to the canvas. palette holds the
+// colors for indices 1..3 at [1..3] in canvas byte order (swap565).
+void drawIndexedSprite(Canvas& canvas, int x, int y, const IndexedSprite& sprite, const uint16_t palette[4]);
+
+#endif // INDEXED_SPRITE_H
@@ -0,0 +1,111 @@
+#include "Parallax.h"
+#include "config.h"
+#include <assert.h>
+#include <string.h>
+
+// Uncovered column range [x0, x1) of the row being composited
+struct RowGap {
+  int16_t x0;
+  int16_t x1;
+};
+
+// Gaps are disjoint, non-empty and separated by covered columns
+static const int MAX_ROW_GAPS = (SCREEN_WIDTH + 1) / 2;
+
+static int layerWidth(const ParallaxLayer& layer) {
+  return layer.tile ? layer.tile->width : layer.sprite->width;
+}
+
+// Copy the still uncovered part of the run [x0, x0 + length) from src (the
+// run's pixels) and remove it from the gap list; returns the new gap count
+static int fillGaps(RowGap* gaps, int gapCount, int x0, int length, uint16_t* dst, const uint16_t* src) {
+  const int x1 = x0 + length;
+  RowGap out[MAX_ROW_GAPS];
+  int outCount = 0;
+
+  for (int i = 0; i < gapCount; i++) {
+    RowGap gap = gaps[i];
+    int a = x0 > gap.x0 ? x0 : gap.x0;
+    int b = x1 < gap.x1 ? x1 : gap.x1;
+    if (a >= b) {
+      out[outCount++] = gap;
+      continue;
+    }
+
+    memcpy(dst + a, src + (a - x0), (b - a) * sizeof(uint16_t));
+    if (gap.x0 < a) {
+      out[outCount].x0 = gap.x0;
+      out[outCount++].x1 = (int16_t)a;
+    }
+    if (b < gap.x1) {
+      out[outCount].x0 = (int16_t)b;
+      out[outCount++].x1 = gap.x1;
+    }
+  }
+
+  memcpy(gaps, out, outCount * sizeof(RowGap));
+  return outCount;
+}
+
+ParallaxBackground::ParallaxBackground(const ParallaxLayer* layers, int count)
+  : _layers(layers)
+  , _count(count) {
+  assert(count > 0 && count <= MAX_PARALLAX_LAYERS);
+  for (int i = 0; i < MAX_PARALLAX_LAYERS; i++) {
+    _scrollX[i] = 0;
+  }
+}
+
+void ParallaxBackground::update(float dt) {
+  for (int i = 0; i < _count; i++) {
+    float width = (float)layerWidth(_layers[i]);
+    _scrollX[i] += _layers[i].speed * dt;
+    while (_scrollX[i] >= width) _scrollX[i] -= width;
+    while (_scrollX[i] < 0) _scrollX[i] += width;
+  }
+}
+
+void ParallaxBackground::draw(Canvas& canvas) const {
+  const int canvasWidth = canvas.width() < SCREEN_WIDTH ? canvas.width() : SCREEN_WIDTH;
+  const int canvasHeight = canvas.height();
+  uint16_t* buffer = (uint16_t*)canvas.getBuffer();
+  RowGap gaps[MAX_ROW_GAPS];
+
+  for (int y = 0; y < canvasHeight; y++) {
+    uint16_t* dst = buffer + y * canvas.width();
+    gaps[0].x0 = 0;
+    gaps[0].x1 = (int16_t)canvasWidth;
+    int gapCount = 1;
+
+    for (int i = _count - 1; i >= 0 && gapCount > 0; i--) {
+      const ParallaxLayer& layer = _layers[i];
+      const int scrollX = (int)_scrollX[i];
+
+      if (layer.tile) {
+        // Opaque layer: fill every remaining gap from the wrapped tile row
+        const ScrollLayer& tile = *layer.tile;
+        int ty = tile.repeatY ? y % tile.height : y;
+        if (ty >= tile.height) continue;
+        const uint16_t* row = tile.pixels + ty * tile.width;
+        for (int g = 0; g < gapCount; g++) {
+          copyScrollRow(dst + gaps[g].x0, row, tile.width, (gaps[g].x0 + scrollX) % tile.width,
+                        gaps[g].x1 - gaps[g].x0);
+        }
+        gapCount = 0;
+        continue;
+      }
+
+      // Transparent layer: each opaque run, repeated across the canvas
+      const SpanSprite& sprite = *layer.sprite;
+      if (y >= sprite.height) continue;
+      for (int r = sprite.rowStart[y]; r < sprite.rowStart[y + 1] && gapCount > 0; r++) {
+        const SpanRun& run = sprite.runs[r];
+        int x = run.x - scrollX;
+        if (x + run.length <= 0) x += sprite.width;
+        for (; x < canvasWidth && gapCount > 0; x += sprite.width) {
+          gapCount = fillGaps(gaps, gapCount, x, run.length, dst, sprite.pixels + run.offset);
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef PARALLAX_H
+#define PARALLAX_H
+
+#include "ScrollLayer.h"
+#include "SpanSprite.h"
+
+// Layers per ParallaxBackground (sizes the per-layer scroll state). Scenes
+// with a constant layer table should static_assert against it.
+static const int MAX_PARALLAX_LAYERS = 4;
+
+// One horizontally scrolling layer. Exactly one of tile (opaque) or
+// sprite (transparent, drawn as opaque runs) is set. Transparent layers
+// repeat horizontally only.
+struct ParallaxLayer {
+  const ScrollLayer* tile;
+  const SpanSprite* sprite;
+  float speed;  // Scroll speed in pixels per second
+};
+
+// Stack of scrolling layers composited front to back, row by row: each
+// layer only fills the columns no nearer layer has covered yet, so every
+// canvas pixel is written exactly once. Layers are given back to front and
+// the first one must be opaque and cover the canvas.
+class ParallaxBackground {
+public:
+  // count must be 1..MAX_PARALLAX_LAYERS (asserted)
+  ParallaxBackground(const ParallaxLayer* layers, int count);
+
+  void update(float dt);
+  void draw(Canvas& canvas) const;
+
+private:
+  const ParallaxLayer* _layers;
+  int _count;
+  float _scrollX[MAX_PARALLAX_LAYERS];  // Wrapped to [0, layer width)
+};
+
+#endif // PARALLAX_H
@@ -0,0 +1,178 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include "core/hardware/Display.h"
+#include "Blend565.h"
+
+// Fixed-capacity particle system, statically allocated.
+//
+// Particles are stored as a dense structure of arrays (no stable ids, so
+// dead particles are swap-removed by copying the last one over them) and
+// integrated in fixed point: positions in Q8 pixels, velocities in Q8
+// pixels per second, time in Q12 seconds. Each particle is a size x size
+// square drawn as short row spans straight into the canvas buffer, faded
+// with its remaining life.
+//
+// Budgets keep the cost bounded: at most spawnBudget particles are accepted
+// between two update() calls (extra requests are dropped and counted) and
+// at most drawBudget particles are drawn per frame.
+template<uint16_t Capacity>
+class ParticleSystem {
+public:
+  ParticleSystem(uint16_t spawnBudget, uint16_t drawBudget)
+    : _count(0)
+    , _spawnBudget(spawnBudget)
+    , _spawnsLeft(spawnBudget)
+    , _drawBudget(drawBudget)
+    , _gravity(0)
+    , _dropped(0)
+    , _seed(0x9E3779B9u) {
+  }
+
+  // Downward acceleration in pixels per second squared
+  void setGravity(float pxPerS2) { _gravity = (int32_t)(pxPerS2 * 256.0f); }
+
+  // Add one particle; returns false if over the spawn budget or full
+  bool emit(float x, float y, float vx, float vy, uint16_t lifeMs, uint16_t color, uint8_t size = 1) {
+    if (_spawnsLeft == 0 || _count >= Capacity || lifeMs == 0) {
+      _dropped++;
+      return false;
+    }
+    _spawnsLeft--;
+
+    uint16_t i = _count++;
+    _x[i] = (int32_t)(x * 256.0f);
+    _y[i] = (int32_t)(y * 256.0f);
+    _vx[i] = (int32_t)(vx * 256.0f);
+    _vy[i] = (int32_t)(vy * 256.0f);
+    _life[i] = lifeMs;
+    _lifeTotal[i] = lifeMs;
+    _color[i] = swap565(color);
+    _size[i] = size;
+    return true;
+  }
+
+  // Emit count particles from (x, y) in evenly spread directions with
+  // jittered speed (speed * 0.5 .. speed * 1.5); returns the number accepted
+  int burst(float x, float y, int count, float speed, uint16_t lifeMs, uint16_t color, uint8_t size = 1) {
+    int accepted = 0;
+    uint8_t start = (uint8_t)nextRandom();
+    for (int n = 0; n < count; n++) {
+      uint8_t dir = (uint8_t)((start + n * DIRECTIONS / count) & (DIRECTIONS - 1));
+      float s = speed * (0.5f + (nextRandom() & 0xFF) / 256.0f);
+      float vx = s * DIRECTION_X[dir] / 256.0f;
+      float vy = s * DIRECTION_X[(dir + DIRECTIONS / 4) & (DIRECTIONS - 1)] / 256.0f;
+      if (emit(x, y, vx, vy, lifeMs, color, size)) {
+        accepted++;
+      }
+    }
+    return accepted;
+  }
+
+  // Integrate and expire particles; refills the spawn budget
+  void update(float dt) {
+    _spawnsLeft = _spawnBudget;
+
+    if (dt > 0.25f) dt = 0.25f;  // Keep the Q12 products in range after a stall
+    const int32_t dtQ12 = (int32_t)(dt * 4096.0f);
+    const uint16_t dtMs = (uint16_t)(dt * 1000.0f);
+    const int32_t dvy = (_gravity * dtQ12) >> 12;
+
+    for (uint16_t i = 0; i < _count;) {
+      if (_life[i] <= dtMs) {
+        removeAt(i);  // Last particle moves to i
+        continue;
+      }
+      _life[i] -= dtMs;
+      _vy[i] += dvy;
+      _x[i] += (_vx[i] * dtQ12) >> 12;
+      _y[i] += (_vy[i] * dtQ12) >> 12;
+      i++;
+    }
+  }
+
+  void draw(Canvas& canvas) const {
+    const int canvasWidth = canvas.width();
+    const int canvasHeight = canvas.height();
+    uint16_t* buffer = (uint16_t*)canvas.getBuffer();
+    const uint16_t n = _count < _drawBudget ? _count : _drawBudget;
+
+    for (uint16_t i = 0; i < n; i++) {
+      int x0 = _x[i] >> 8;
+      int y0 = _y[i] >> 8;
+      int x1 = x0 + _size[i];
+      int y1 = y0 + _size[i];
+      if (x0 < 0) x0 = 0;
+      if (y0 < 0) y0 = 0;
+      if (x1 > canvasWidth) x1 = canvasWidth;
+      if (y1 > canvasHeight) y1 = canvasHeight;
+      if (x0 >= x1 || y0 >= y1) continue;
+
+      // Fade out linearly over the particle's life
+      uint8_t alpha = (uint8_t)(((uint32_t)_life[i] * ALPHA_OPAQUE) / _lifeTotal[i]);
+      if (alpha == 0) continue;
+
+      const uint16_t color = _color[i];
+      for (int y = y0; y < y1; y++) {
+        uint16_t* dst = buffer + y * canvasWidth;
+        for (int x = x0; x < x1; x++) {
+          dst[x] = alpha >= ALPHA_OPAQUE ? color : blendSwapped565(color, dst[x], alpha);
+        }
+      }
+    }
+  }
+
+  void clear() { _count = 0; }
+
+  uint16_t count() const { return _count; }
+  uint32_t getDroppedCount() const { return _dropped; }
+
+private:
+  // Unit vectors at 22.5 degree steps (Q8); y uses the table a quarter turn on
+  static const int DIRECTIONS = 16;
+  static const int16_t DIRECTION_X[DIRECTIONS];
+
+  void removeAt(uint16_t i) {
+    uint16_t last = --_count;
+    _x[i] = _x[last];
+    _y[i] = _y[last];
+    _vx[i] = _vx[last];
+    _vy[i] = _vy[last];
+    _life[i] = _life[last];
+    _lifeTotal[i] = _lifeTotal[last];
+    _color[i] = _color[last];
+    _size[i] = _size[last];
+  }
+
+  // xorshift32
+  uint32_t nextRandom() {
+    _seed ^= _seed << 13;
+    _seed ^= _seed >> 17;
+    _seed ^= _seed << 5;
+    return _seed;
+  }
+
+  int32_t _x[Capacity];           // Q8 pixels
+  int32_t _y[Capacity];
+  int32_t _vx[Capacity];          // Q8 pixels per second
+  int32_t _vy[Capacity];
+  uint16_t _life[Capacity];       // Remaining ms
+  uint16_t _lifeTotal[Capacity];
+  uint16_t _color[Capacity];      // Canvas byte order
+  uint8_t _size[Capacity];
+
+  uint16_t _count;
+  uint16_t _spawnBudget;
+  uint16_t _spawnsLeft;
+  uint16_t _drawBudget;
+  int32_t _gravity;               // Q8 pixels per second squared
+  uint32_t _dropped;
+  uint32_t _seed;
+};
+
+template<uint16_t Capacity>
+const int16_t ParticleSystem<Capacity>::DIRECTION_X[ParticleSystem<Capacity>::DIRECTIONS] = {
+  256, 237, 181, 98, 0, -98, -181, -237, -256, -237, -181, -98, 0, 98, 181, 237
+};
+
+#endif // PARTICLE_SYSTEM_H
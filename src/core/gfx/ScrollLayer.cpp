@@ -0,0 +1,35 @@
+#include "ScrollLayer.h"
+#include <string.h>
+
+// Non-negative a mod b
+static inline int wrap(int a, int b) {
+  int r = a % b;
+  return r < 0 ? r + b : r;
+}
+
+void copyScrollRow(uint16_t* dst, const uint16_t* tileRow, int tileWidth, int tileX, int count) {
+  // Tail of the tile row, then whole tile rows until count is reached
+  int n = tileWidth - tileX < count ? tileWidth - tileX : count;
+  memcpy(dst, tileRow + tileX, n * sizeof(uint16_t));
+  for (int x = n; x < count; x += n) {
+    n = count - x < tileWidth ? count - x : tileWidth;
+    memcpy(dst + x, tileRow, n * sizeof(uint16_t));
+  }
+}
+
+void drawScrollLayer(Canvas& canvas, const ScrollLayer& layer, int scrollX, int scrollY) {
+  const int canvasWidth = canvas.width();
+  const int canvasHeight = canvas.height();
+  uint16_t* buffer = (uint16_t*)canvas.getBuffer();
+  const int startX = wrap(scrollX, layer.width);
+
+  for (int y = 0; y < canvasHeight; y++) {
+    int ty = y + scrollY;
+    if (layer.repeatY) {
+      ty = wrap(ty, layer.height);
+    } else if (ty < 0 || ty >= layer.height) {
+      continue;
+    }
+    copyScrollRow(buffer + y * canvasWidth, layer.pixels + ty * layer.width, layer.width, startX, canvasWidth);
+  }
+}
@@ -0,0 +1,25 @@
+#ifndef SCROLL_LAYER_H
+#define SCROLL_LAYER_H
+
+#include "core/hardware/Display.h"
+
+// Opaque background tile stored in flash, in canvas byte order (swap565).
+// The tile always repeats horizontally; repeatY also wraps it vertically,
+// otherwise rows outside the tile are left untouched.
+struct ScrollLayer {
+  int16_t width;
+  int16_t height;
+  const uint16_t* pixels;
+  bool repeatY;
+};
+
+// Draw the layer scrolled so tile pixel (scrollX, scrollY) lands on the
+// canvas origin. Rows are memcpy'd straight into the canvas buffer with
+// modular wrap; scroll values may be negative or exceed the tile size.
+void drawScrollLayer(Canvas& canvas, const ScrollLayer& layer, int scrollX, int scrollY = 0);
+
+// Copy count pixels of a repeating tile row into dst, starting at tile
+// column tileX (0 <= tileX < tileWidth)
+void copyScrollRow(uint16_t* dst, const uint16_t* tileRow, int tileWidth, int tileX, int count);
+
+#endif // SCROLL_LAYER_H
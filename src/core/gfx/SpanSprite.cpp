@@ -0,0 +1,66 @@
+#include "SpanSprite.h"
+#include "Blend565.h"
+#include <string.h>
+
+// Visit every run of the sprite at (x, y) clipped to the canvas:
+// blit(dst, pixelIndex, count) with dst in the canvas buffer
+template<typename Blit>
+static void forEachClippedRun(Canvas& canvas, int x, int y, const SpanSprite& sprite, Blit blit) {
+  const int canvasWidth = canvas.width();
+  const int canvasHeight = canvas.height();
+
+  // Clip rows to the canvas
+  int y0 = y < 0 ? -y : 0;
+  int y1 = sprite.height;
+  if (y + y1 > canvasHeight) y1 = canvasHeight - y;
+  if (y0 >= y1 || x >= canvasWidth || x + sprite.width <= 0) return;
+
+  uint16_t* buffer = (uint16_t*)canvas.getBuffer();
+
+  for (int sy = y0; sy < y1; sy++) {
+    uint16_t* dst = buffer + (y + sy) * canvasWidth;
+    for (int r = sprite.rowStart[sy]; r < sprite.rowStart[sy + 1]; r++) {
+      const SpanRun& run = sprite.runs[r];
+      int index = run.offset;
+
+      // Clip the run to [0, canvasWidth)
+      int a = x + run.x;
+      int b = a + run.length;
+      if (a < 0) {
+        index -= a;
+        a = 0;
+      }
+      if (b > canvasWidth) b = canvasWidth;
+      if (a < b) {
+        blit(dst + a, index, b - a);
+      }
+    }
+  }
+}
+
+void drawSpanSprite(Canvas& canvas, int x, int y, const SpanSprite& sprite) {
+  forEachClippedRun(canvas, x, y, sprite, [&](uint16_t* dst, int index, int count) {
+    memcpy(dst, sprite.pixels + index, count * sizeof(uint16_t));
+  });
+}
+
+void drawSpanSpriteBlend(Canvas& canvas, int x, int y, const SpanSprite& sprite, uint8_t alpha) {
+  if (alpha == 0) return;
+  if (alpha >= ALPHA_OPAQUE && !sprite.alpha) {
+    drawSpanSprite(canvas, x, y, sprite);
+    return;
+  }
+
+  forEachClippedRun(canvas, x, y, sprite, [&](uint16_t* dst, int index, int count) {
+    const uint16_t* src = sprite.pixels + index;
+    const uint8_t* srcAlpha = sprite.alpha ? sprite.alpha + index : nullptr;
+    for (int i = 0; i < count; i++) {
+      uint8_t a = srcAlpha ? mulAlpha(srcAlpha[i], alpha) : alpha;
+      if (a >= ALPHA_OPAQUE) {
+        dst[i] = src[i];
+      } else if (a) {
+        dst[i] = blendSwapped565(src[i], dst[i], a);
+      }
+    }
+  });
+}
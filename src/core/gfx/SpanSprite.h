@@ -0,0 +1,34 @@
+#ifndef SPAN_SPRITE_H
+#define SPAN_SPRITE_H
+
+#include "core/hardware/Display.h"
+
+// One opaque run of a span sprite row
+struct SpanRun {
+  uint8_t x;        // First column
+  uint8_t length;   // Pixels in the run
+  uint16_t offset;  // Index of the run's first pixel in SpanSprite::pixels
+};
+
+// Transparent sprite stored as opaque runs per row, in flash. Only opaque
+// pixels are stored (canvas byte order, swap565), so drawing is a copy per
+// run with no per-pixel mask test. Row r's runs are
+// runs[rowStart[r] .. rowStart[r + 1]), ordered by x.
+struct SpanSprite {
+  int16_t width;
+  int16_t height;
+  const uint16_t* rowStart;  // height + 1 entries
+  const SpanRun* runs;
+  const uint16_t* pixels;
+  const uint8_t* alpha;      // Per-pixel alpha 0..32 (parallel to pixels), or nullptr if opaque
+};
+
+// Draw with top-left at (x, y), copying only the opaque runs, clipped to
+// the canvas. Per-pixel alpha is ignored.
+void drawSpanSprite(Canvas& canvas, int x, int y, const SpanSprite& sprite);
+
+// Like drawSpanSprite, but blended over the canvas with alpha 0..32 times
+// the sprite's per-pixel alpha (see Blend565.h)
+void drawSpanSpriteBlend(Canvas& canvas, int x, int y, const SpanSprite& sprite, uint8_t alpha);
+
+#endif // SPAN_SPRITE_H
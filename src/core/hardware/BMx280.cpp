@@ -0,0 +1,133 @@
+#include "BMx280.h"
+#include <Arduino.h>
+#include <Wire.h>
+
+// Register map (shared by BMP280 and BME280)
+static const uint8_t REG_CALIB = 0x88;      // 24 bytes: dig_T1..dig_P9
+static const uint8_t REG_CHIP_ID = 0xD0;
+static const uint8_t REG_RESET = 0xE0;
+static const uint8_t REG_CTRL_HUM = 0xF2;   // BME280 only
+static const uint8_t REG_CTRL_MEAS = 0xF4;
+static const uint8_t REG_CONFIG = 0xF5;
+static const uint8_t REG_DATA = 0xF7;       // press_msb..temp_xlsb (6 bytes)
+
+static const uint8_t RESET_COMMAND = 0xB6;
+static const uint8_t MODE_NORMAL = 0x03;
+
+static uint16_t readU16LE(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+bool BMx280::begin(uint8_t address, uint8_t expectedChipId) {
+  _address = address;
+  _chipId = 0xFF;
+
+  uint8_t id;
+  if (!readRegisters(REG_CHIP_ID, &id, 1)) {
+    return false;
+  }
+  _chipId = id;
+  if (id != expectedChipId) {
+    return false;
+  }
+
+  // Soft reset, then wait for the NVM calibration copy to finish
+  writeRegister(REG_RESET, RESET_COMMAND);
+  delay(10);
+
+  uint8_t buffer[24];
+  if (!readRegisters(REG_CALIB, buffer, sizeof(buffer))) {
+    return false;
+  }
+  _calib.t1 = readU16LE(buffer + 0);
+  _calib.t2 = (int16_t)readU16LE(buffer + 2);
+  _calib.t3 = (int16_t)readU16LE(buffer + 4);
+  _calib.p1 = readU16LE(buffer + 6);
+  _calib.p2 = (int16_t)readU16LE(buffer + 8);
+  _calib.p3 = (int16_t)readU16LE(buffer + 10);
+  _calib.p4 = (int16_t)readU16LE(buffer + 12);
+  _calib.p5 = (int16_t)readU16LE(buffer + 14);
+  _calib.p6 = (int16_t)readU16LE(buffer + 16);
+  _calib.p7 = (int16_t)readU16LE(buffer + 18);
+  _calib.p8 = (int16_t)readU16LE(buffer + 20);
+  _calib.p9 = (int16_t)readU16LE(buffer + 22);
+  return true;
+}
+
+void BMx280::configure(Oversampling pressure, Oversampling temperature, Filter filter, Standby standby) {
+  // Config must be written in sleep mode; ctrl_hum only latches on a ctrl_meas write
+  writeRegister(REG_CTRL_MEAS, 0x00);
+  if (_chipId == CHIP_ID_BME280) {
+    writeRegister(REG_CTRL_HUM, OVERSAMPLING_SKIP);
+  }
+  writeRegister(REG_CONFIG, (uint8_t)((standby << 5) | (filter << 2)));
+  writeRegister(REG_CTRL_MEAS, (uint8_t)((temperature << 5) | (pressure << 2) | MODE_NORMAL));
+}
+
+bool BMx280::read(int32_t& temperature, uint32_t& pressure) {
+  // One burst covers both measurements, so they come from the same conversion
+  uint8_t data[6];
+  if (!readRegisters(REG_DATA, data, sizeof(data))) {
+    return false;
+  }
+
+  int32_t adcP = ((int32_t)data[0] << 12) | ((int32_t)data[1] << 4) | (data[2] >> 4);
+  int32_t adcT = ((int32_t)data[3] << 12) | ((int32_t)data[4] << 4) | (data[5] >> 4);
+
+  int32_t tFine;
+  temperature = compensateTemperature(adcT, tFine);
+  pressure = compensatePressure(adcP, tFine);
+  return true;
+}
+
+bool BMx280::readRegisters(uint8_t reg, uint8_t* buffer, uint8_t length) {
+  Wire.beginTransmission(_address);
+  Wire.write(reg);
+  if (Wire.endTransmission(false) != 0) {
+    return false;
+  }
+  if (Wire.requestFrom(_address, length) != length) {
+    return false;
+  }
+  for (uint8_t i = 0; i < length; i++) {
+    buffer[i] = Wire.read();
+  }
+  return true;
+}
+
+void BMx280::writeRegister(uint8_t reg, uint8_t value) {
+  Wire.beginTransmission(_address);
+  Wire.write(reg);
+  Wire.write(value);
+  Wire.endTransmission();
+}
+
+// Bosch BMP280 datasheet 8.2: returns 0.01 C, tFine carries into pressure
+int32_t BMx280::compensateTemperature(int32_t adcT, int32_t& tFine) const {
+  int32_t var1 = ((((adcT >> 3) - ((int32_t)_calib.t1 << 1))) * ((int32_t)_calib.t2)) >> 11;
+  int32_t var2 = (((((adcT >> 4) - ((int32_t)_calib.t1)) *
+                    ((adcT >> 4) - ((int32_t)_calib.t1))) >> 12) *
+                  ((int32_t)_calib.t3)) >> 14;
+  tFine = var1 + var2;
+  return (tFine * 5 + 128) >> 8;
+}
+
+// Bosch BMP280 datasheet 8.2 (64-bit variant): returns Pa in Q24.8
+uint32_t BMx280::compensatePressure(int32_t adcP, int32_t tFine) const {
+  int64_t var1 = ((int64_t)tFine) - 128000;
+  int64_t var2 = var1 * var1 * (int64_t)_calib.p6;
+  var2 = var2 + ((var1 * (int64_t)_calib.p5) << 17);
+  var2 = var2 + (((int64_t)_calib.p4) << 35);
+  var1 = ((var1 * var1 * (int64_t)_calib.p3) >> 8) + ((var1 * (int64_t)_calib.p2) << 12);
+  var1 = (((((int64_t)1) << 47) + var1)) * ((int64_t)_calib.p1) >> 33;
+  if (var1 == 0) {
+    return 0;  // Avoid division by zero (uncalibrated chip)
+  }
+
+  int64_t p = 1048576 - adcP;
+  p = (((p << 31) - var2) * 3125) / var1;
+  var1 = (((int64_t)_calib.p9) * (p >> 13) * (p >> 13)) >> 25;
+  var2 = (((int64_t)_calib.p8) * p) >> 19;
+  p = ((p + var1 + var2) >> 8) + (((int64_t)_calib.p7) << 4);
+  return (uint32_t)p;
+}
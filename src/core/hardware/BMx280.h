@@ -0,0 +1,76 @@
+#ifndef BMX280_H
+#define BMX280_H
+
+#include <stdint.h>
+
+// Minimal BMP280/BME280 driver (pressure + temperature only).
+// Each read() is a single 6-byte I2C burst of the raw pressure and
+// temperature registers, compensated once with Bosch's integer formulas
+// (32-bit temperature, 64-bit pressure) - no floating point.
+class BMx280 {
+public:
+  // Chip IDs reported by register 0xD0
+  static const uint8_t CHIP_ID_BMP280 = 0x58;
+  static const uint8_t CHIP_ID_BME280 = 0x60;
+
+  // Oversampling settings (osrs_p / osrs_t)
+  enum Oversampling : uint8_t {
+    OVERSAMPLING_SKIP = 0,
+    OVERSAMPLING_X1 = 1,
+    OVERSAMPLING_X2 = 2,
+    OVERSAMPLING_X4 = 3,
+    OVERSAMPLING_X8 = 4,
+    OVERSAMPLING_X16 = 5
+  };
+
+  // IIR filter coefficient
+  enum Filter : uint8_t {
+    FILTER_OFF = 0,
+    FILTER_X2 = 1,
+    FILTER_X4 = 2,
+    FILTER_X8 = 3,
+    FILTER_X16 = 4
+  };
+
+  // Normal-mode standby time (BMP280 encoding; BME280 matches up to 1000 ms)
+  enum Standby : uint8_t {
+    STANDBY_MS_0_5 = 0,
+    STANDBY_MS_62_5 = 1,
+    STANDBY_MS_125 = 2,
+    STANDBY_MS_250 = 3
+  };
+
+  // Probe the chip at address and load its calibration.
+  // Returns false if nothing answers with the expected chip ID.
+  bool begin(uint8_t address, uint8_t expectedChipId);
+
+  // Chip ID read by the last begin() (0xFF if nothing answered)
+  uint8_t getChipId() const { return _chipId; }
+
+  // Start normal-mode measurements
+  void configure(Oversampling pressure, Oversampling temperature, Filter filter, Standby standby);
+
+  // Burst-read and compensate one measurement.
+  // temperature: 0.01 C units, pressure: Pa in Q24.8 fixed point.
+  bool read(int32_t& temperature, uint32_t& pressure);
+
+private:
+  struct Calibration {
+    uint16_t t1;
+    int16_t t2, t3;
+    uint16_t p1;
+    int16_t p2, p3, p4, p5, p6, p7, p8, p9;
+  };
+
+  bool readRegisters(uint8_t reg, uint8_t* buffer, uint8_t length);
+  void writeRegister(uint8_t reg, uint8_t value);
+
+  int32_t compensateTemperature(int32_t adcT, int32_t& tFine) const;
+  uint32_t compensatePressure(int32_t adcP, int32_t tFine) const;
+
+  uint8_t _address = 0x76;
+  uint8_t _chipId = 0xFF;
+  Calibration _calib;
+};
+
+#endif // BMX280_H
@@ -0,0 +1,71 @@
+#ifndef BASELINE_TRACKER_H
+#define BASELINE_TRACKER_H
+
+#include "config.h"
+
+// Online estimate of the ambient (no-breath) pressure.
+// The first BASELINE_WARMUP_SAMPLES readings give a running mean, so a
+// provisional baseline exists from the very first sample. After that the
+// baseline only follows slow drift, and only while no breath is in progress.
+//
+// If the warm-up mean was taken mid-breath and is off by more than the
+// detection threshold, detection never reports idle again and drift
+// tracking alone could not fix it. So once no idle/hold has been seen for
+// BASELINE_STUCK_TIME_S (longer than any plausible breath phase), the
+// baseline follows the signal quickly until detection goes quiet.
+class BaselineTracker {
+public:
+  // Start over for samples arriving at sampleRateHz
+  void reset(int sampleRateHz) {
+    _alpha = 1.0f / (BASELINE_TRACK_TIME_S * sampleRateHz);
+    _recoverAlpha = 1.0f / (BASELINE_RECOVER_TIME_S * sampleRateHz);
+    _stuckLimit = (uint32_t)(BASELINE_STUCK_TIME_S * sampleRateHz);
+    _count = 0;
+    _busyCount = 0;
+    _origin = 0;
+    _offset = 0;
+  }
+
+  // Feed one absolute pressure sample.
+  // quiescent = breath detection reports idle/hold for this sample.
+  void update(float pressure, bool quiescent) {
+    if (_count == 0) {
+      _origin = pressure;
+    }
+    float error = (pressure - _origin) - _offset;
+
+    if (_count < BASELINE_WARMUP_SAMPLES) {
+      _count++;
+      _offset += error / _count;
+    } else if (quiescent) {
+      _busyCount = 0;
+      _offset += error * _alpha;
+    } else if (_busyCount < _stuckLimit) {
+      _busyCount++;
+    } else {
+      _offset += error * _recoverAlpha;
+    }
+  }
+
+  // Current baseline (Pa); the first sample is used until one is fed
+  float getBaseline() const { return _origin + _offset; }
+
+  // True once the warm-up mean is complete
+  bool isSettled() const { return _count >= BASELINE_WARMUP_SAMPLES; }
+
+  // Whether any sample has been fed yet
+  bool hasSamples() const { return _count > 0; }
+
+private:
+  // Baseline = origin (first sample) + offset: drift steps of a few mPa
+  // would round away if added to ~101 kPa in float
+  float _origin = 0;
+  float _offset = 0;
+  float _alpha = 0;
+  float _recoverAlpha = 0;
+  uint32_t _count = 0;
+  uint32_t _busyCount = 0;   // Samples since the last idle/hold
+  uint32_t _stuckLimit = 0;
+};
+
+#endif // BASELINE_TRACKER_H
@@ -0,0 +1,116 @@
+#include "BreathAnalytics.h"
+#include <math.h>
+
+void BreathAnalytics::reset() {
+  _head = 0;
+  _count = 0;
+  _sumCycleMs = 0;
+  _sumCycleMsSq = 0;
+  _sumInhaleMs = 0;
+  _sumExhaleMs = 0;
+  _sumInhalePeak = 0;
+  _sumExhalePeak = 0;
+
+  _state = BREATH_IDLE;
+  _stateStartMs = 0;
+  _inCycle = false;
+  _cycleStartMs = 0;
+  _inhaleMs = 0;
+  _exhaleMs = 0;
+  _inhalePeak = 0;
+  _exhalePeak = 0;
+}
+
+void BreathAnalytics::update(float pressureDelta, BreathState state, uint32_t timestampMs) {
+  // Peak tracking for the cycle in progress
+  int32_t delta = (int32_t)(pressureDelta * 100.0f);
+  if (state == BREATH_INHALE && delta < _inhalePeak) _inhalePeak = delta;
+  if (state == BREATH_EXHALE && delta > _exhalePeak) _exhalePeak = delta;
+
+  if (state != _state) {
+    // Close the phase that just ended
+    uint32_t phaseMs = timestampMs - _stateStartMs;
+    if (_state == BREATH_INHALE) _inhaleMs += phaseMs;
+    if (_state == BREATH_EXHALE) _exhaleMs += phaseMs;
+
+    if (state == BREATH_HOLD) {
+      // A hold breaks the rhythm: drop the partial cycle
+      _inCycle = false;
+      _inhaleMs = 0;
+      _exhaleMs = 0;
+      _inhalePeak = 0;
+      _exhalePeak = 0;
+    } else if (state == BREATH_INHALE && !_inCycle) {
+      // First breath (or first after a hold) is timed from its inhale
+      _inCycle = true;
+      _cycleStartMs = timestampMs;
+    }
+
+    _state = state;
+    _stateStartMs = timestampMs;
+  }
+
+  evictExpired(timestampMs);
+}
+
+void BreathAnalytics::completeCycle(uint32_t timestampMs) {
+  uint32_t cycleMs = timestampMs - _cycleStartMs;
+  if (_inCycle && cycleMs <= BREATH_ANALYTICS_MAX_CYCLE_MS) {
+    BreathCycle cycle = { timestampMs, cycleMs, _inhaleMs, _exhaleMs, _inhalePeak, _exhalePeak };
+    pushCycle(cycle);
+  }
+
+  // The next cycle runs until the next completed breath
+  _inCycle = true;
+  _cycleStartMs = timestampMs;
+  _inhaleMs = 0;
+  _exhaleMs = 0;
+  _inhalePeak = 0;
+  _exhalePeak = 0;
+}
+
+float BreathAnalytics::getCycleStdDevMs() const {
+  if (_count < 2) return 0;
+  float mean = (float)_sumCycleMs / _count;
+  float variance = (float)_sumCycleMsSq / _count - mean * mean;
+  return variance > 0 ? sqrtf(variance) : 0;
+}
+
+void BreathAnalytics::pushCycle(const BreathCycle& cycle) {
+  if (_count == BREATH_ANALYTICS_MAX_CYCLES) {
+    evictOldest();
+  }
+
+  _cycles[_head] = cycle;
+  _head = (_head + 1) % BREATH_ANALYTICS_MAX_CYCLES;
+  _count++;
+
+  _sumCycleMs += cycle.cycleMs;
+  _sumCycleMsSq += (uint64_t)cycle.cycleMs * cycle.cycleMs;
+  _sumInhaleMs += cycle.inhaleMs;
+  _sumExhaleMs += cycle.exhaleMs;
+  _sumInhalePeak += cycle.inhalePeak;
+  _sumExhalePeak += cycle.exhalePeak;
+}
+
+void BreathAnalytics::evictOldest() {
+  const BreathCycle& cycle = _cycles[(_head + BREATH_ANALYTICS_MAX_CYCLES - _count) % BREATH_ANALYTICS_MAX_CYCLES];
+  _sumCycleMs -= cycle.cycleMs;
+  _sumCycleMsSq -= (uint64_t)cycle.cycleMs * cycle.cycleMs;
+  _sumInhaleMs -= cycle.inhaleMs;
+  _sumExhaleMs -= cycle.exhaleMs;
+  _sumInhalePeak -= cycle.inhalePeak;
+  _sumExhalePeak -= cycle.exhalePeak;
+  _count--;
+}
+
+void BreathAnalytics::evictExpired(uint32_t nowMs) {
+  // At most one eviction per sample keeps the worst case O(1); cycles are
+  // seconds apart, so the window still drains far faster than it fills
+  if (_count > 0) {
+    const BreathCycle& oldest = _cycles[(_head + BREATH_ANALYTICS_MAX_CYCLES - _count) % BREATH_ANALYTICS_MAX_CYCLES];
+    if (nowMs - oldest.endMs > BREATH_ANALYTICS_WINDOW_MS) {
+      evictOldest();
+    }
+  }
+}
@@ -0,0 +1,92 @@
+#ifndef BREATH_ANALYTICS_H
+#define BREATH_ANALYTICS_H
+
+#include "config.h"
+#include <stdint.h>
+
+// One completed breath cycle: from the previous breath's completion (or
+// this breath's first inhale) to the end of its exhale
+struct BreathCycle {
+  uint32_t endMs;        // End of the exhale that completed the breath
+  uint32_t cycleMs;
+  uint32_t inhaleMs;     // Time spent inhaling / exhaling within the cycle
+  uint32_t exhaleMs;
+  int32_t inhalePeak;    // Deepest inhale delta (0.01 Pa, <= 0)
+  int32_t exhalePeak;    // Strongest exhale delta (0.01 Pa, >= 0)
+};
+
+// Streaming breath statistics over a sliding window of recent cycles.
+//
+// Fed every filtered sample with its detected state (phase times and
+// peaks). Cycles close on completeCycle(), which BreathData calls exactly
+// where it counts a breath and queues BREATH_EVENT_CYCLE_COMPLETE, so the
+// count, the events and these statistics share one boundary. Completed
+// cycles go into a fixed ring with running integer sums (added on push,
+// subtracted on eviction), so every update and every getter is O(1) and
+// memory is fixed. Cycles leave the window once they are older than
+// BREATH_ANALYTICS_WINDOW_MS or the ring is full.
+class BreathAnalytics {
+public:
+  BreathAnalytics() { reset(); }
+
+  void reset();
+
+  // Consume one filtered sample (Pa) and the state detected for it
+  void update(float pressureDelta, BreathState state, uint32_t timestampMs);
+
+  // A breath completed at timestampMs (after update() for that sample)
+  void completeCycle(uint32_t timestampMs);
+
+  // Cycles currently in the window
+  int getCycleCount() const { return _count; }
+
+  // Breaths per minute from the mean cycle length (0 until a cycle completes)
+  float getBreathsPerMinute() const { return _count ? 60000.0f * _count / _sumCycleMs : 0; }
+
+  float getMeanCycleMs() const { return _count ? (float)_sumCycleMs / _count : 0; }
+  float getMeanInhaleMs() const { return _count ? (float)_sumInhaleMs / _count : 0; }
+  float getMeanExhaleMs() const { return _count ? (float)_sumExhaleMs / _count : 0; }
+
+  // Inhale:exhale time ratio (1:x is printed as 1:(1/ratio)); 0 if unknown
+  float getIERatio() const { return _sumExhaleMs ? (float)_sumInhaleMs / _sumExhaleMs : 0; }
+
+  // Breath-to-breath variability: standard deviation of cycle length (ms)
+  float getCycleStdDevMs() const;
+
+  // Mean peak deltas per phase (Pa): inhale <= 0, exhale >= 0
+  float getMeanInhalePeak() const { return _count ? _sumInhalePeak / (100.0f * _count) : 0; }
+  float getMeanExhalePeak() const { return _count ? _sumExhalePeak / (100.0f * _count) : 0; }
+
+  // Most recent completed cycle (only valid when getCycleCount() > 0)
+  const BreathCycle& getLastCycle() const {
+    return _cycles[(_head + BREATH_ANALYTICS_MAX_CYCLES - 1) % BREATH_ANALYTICS_MAX_CYCLES];
+  }
+
+private:
+  void pushCycle(const BreathCycle& cycle);
+  void evictOldest();
+  void evictExpired(uint32_t nowMs);
+
+  // Window ring and running sums
+  BreathCycle _cycles[BREATH_ANALYTICS_MAX_CYCLES];
+  int _head;   // Next write position
+  int _count;
+  uint32_t _sumCycleMs;
+  uint64_t _sumCycleMsSq;
+  uint32_t _sumInhaleMs;
+  uint32_t _sumExhaleMs;
+  int32_t _sumInhalePeak;
+  int32_t _sumExhalePeak;
+
+  // Cycle in progress
+  BreathState _state;
+  uint32_t _stateStartMs;
+  bool _inCycle;          // _cycleStartMs is valid (no hold since)
+  uint32_t _cycleStartMs;
+  uint32_t _inhaleMs;
+  uint32_t _exhaleMs;
+  int32_t _inhalePeak;
+  int32_t _exhalePeak;
+};
+
+#endif // BREATH_ANALYTICS_H
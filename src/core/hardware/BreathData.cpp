@@ -6,26 +6,41 @@
   #include "Platform.h"
 #endif
 
+BreathData::BreathData()
+  : inhalePeaks(1.0f, 2000.0f, NORM_PEAK_DECAY)
+  , exhalePeaks(1.0f, 2000.0f, NORM_PEAK_DECAY) {
+}
+
 void BreathData::init() {
   currentState = BREATH_IDLE;
   breathStartTime = 0;
   lastBreathTime = 0;
   breathCount = 0;
-  averageBreathDuration = 0;
-  sessionStartTime = millis();
+  cycleHasInhale = false;
+  sessionStartTime = Clock::millis();
+  analytics.reset();
+  events.clear();
   inhaleThreshold = DEFAULT_INHALE_THRESHOLD;
   exhaleThreshold = DEFAULT_EXHALE_THRESHOLD;
+  signalFilter.reset();
+  filteredDelta = 0;
   normalizedBreathRaw = 0;
-  minPressureDelta = -10.0f;
-  maxPressureDelta = 10.0f;
+  predictor.reset();
+  lastSampleTime = 0;
+  sampleIntervalMs = 1000.0f / SENSOR_SAMPLE_RATE_HZ;
+  resetCalibration();
 }
 
-void BreathData::detect(float pressureDelta) {
+void BreathData::detect(float rawDelta, unsigned long timestampMs) {
+  filteredDelta = signalFilter.process(rawDelta);
+  float pressureDelta = filteredDelta;
+
   BreathState previousState = currentState;
-  unsigned long now = millis();
+  unsigned long now = timestampMs;
 
-  // Expand calibration bounds only when exceeding overage threshold
-  // This filters out small noise spikes that would otherwise shrink normalized values
+  // Expand calibration bounds right away when exceeding the overage threshold,
+  // so a stronger breath is not clipped until its phase ends (updateBounds()
+  // then settles them on the recent peak percentile)
   if (pressureDelta < minPressureDelta * NORM_OVERAGE_THRESHOLD && minPressureDelta < -0.1f) {
     // Inhale exceeds threshold - expand gradually
     float ratio = pressureDelta / (minPressureDelta * NORM_OVERAGE_THRESHOLD);
@@ -37,21 +52,26 @@ void BreathData::detect(float pressureDelta) {
     maxPressureDelta *= ratio;
   }
 
-  // Calculate normalized breath (-1 to +1)
-  if (pressureDelta < 0 && minPressureDelta < -0.1f) {
-    // Inhale: map [minPressureDelta..0] → [-1..0]
-    normalizedBreathRaw = pressureDelta / (-minPressureDelta);
-  } else if (pressureDelta > 0 && maxPressureDelta > 0.1f) {
-    // Exhale: map [0..maxPressureDelta] → [0..1]
-    normalizedBreathRaw = pressureDelta / maxPressureDelta;
-  } else {
-    normalizedBreathRaw = 0;
+  normalizedBreathRaw = normalize(pressureDelta);
+
+  // Predict in Pa, so a bounds change is not mistaken for breath movement.
+  // The rate is per sample; track the actual sample spacing to convert it
+  // (gaps longer than the prediction horizon are stalls, not the rate)
+  predictor.process(pressureDelta);
+  unsigned long intervalMs = now - lastSampleTime;
+  if (intervalMs > 0 && intervalMs <= BREATH_PREDICT_MAX_MS) {
+    sampleIntervalMs += (intervalMs - sampleIntervalMs) * 0.125f;
   }
+  lastSampleTime = now;
 
-  // Detect breath state based on pressure delta
-  if (pressureDelta < inhaleThreshold) {
+  // Detect breath state based on pressure delta. Hysteresis: an inhale or
+  // exhale only ends once the delta is BREATH_HYSTERESIS_PA back inside its
+  // threshold, so noise around a threshold does not flap the state
+  if (pressureDelta < inhaleThreshold ||
+      (previousState == BREATH_INHALE && pressureDelta < inhaleThreshold + BREATH_HYSTERESIS_PA)) {
     currentState = BREATH_INHALE;
-  } else if (pressureDelta > exhaleThreshold) {
+  } else if (pressureDelta > exhaleThreshold ||
+             (previousState == BREATH_EXHALE && pressureDelta > exhaleThreshold - BREATH_HYSTERESIS_PA)) {
     currentState = BREATH_EXHALE;
   } else {
     // Check for breath hold (stable pressure for >3 seconds)
@@ -63,35 +83,138 @@ void BreathData::detect(float pressureDelta) {
     }
   }
 
-  // Detect breath transitions for counting
+  // Phase times first, so a breath completed below closes a full cycle
+  analytics.update(pressureDelta, currentState, now);
+
+  // Detect breath transitions for events and counting
   if (previousState != currentState) {
     breathStartTime = now;
 
-    // Count a full breath cycle when transitioning from exhale to inhale
-    if (previousState == BREATH_EXHALE && currentState == BREATH_INHALE) {
-      breathCount++;
-
-      // Update average breath duration
-      unsigned long cycleDuration = now - lastBreathTime;
-      if (breathCount == 1) {
-        averageBreathDuration = cycleDuration;
-      } else {
-        averageBreathDuration =
-          (averageBreathDuration * (breathCount - 1) + cycleDuration) / breathCount;
+    updateBounds(previousState);
+    phasePeak = 0;
+    queueTransition(previousState, currentState, now);
+
+    lastBreathTime = now;
+  }
+
+  // Track the extreme of the current phase
+  if (currentState == BREATH_INHALE && pressureDelta < phasePeak) {
+    phasePeak = pressureDelta;
+  } else if (currentState == BREATH_EXHALE && pressureDelta > phasePeak) {
+    phasePeak = pressureDelta;
+  }
+}
+
+// Queue the end of the previous phase and the start of the new one. A breath
+// counts once an exhale ends after an inhale, even with idle or hold between
+// the two phases.
+void BreathData::queueTransition(BreathState from, BreathState to, unsigned long timestampMs) {
+  switch (from) {
+    case BREATH_INHALE:
+      pushEvent(BREATH_EVENT_INHALE_END, timestampMs);
+      break;
+    case BREATH_EXHALE:
+      pushEvent(BREATH_EVENT_EXHALE_END, timestampMs);
+      if (cycleHasInhale) {
+        cycleHasInhale = false;
+        breathCount++;
+        analytics.completeCycle(timestampMs);
+        pushEvent(BREATH_EVENT_CYCLE_COMPLETE, timestampMs);
       }
+      break;
+    case BREATH_HOLD:
+      pushEvent(BREATH_EVENT_HOLD_END, timestampMs);
+      break;
+    default:
+      break;
+  }
+
+  switch (to) {
+    case BREATH_INHALE:
+      cycleHasInhale = true;
+      pushEvent(BREATH_EVENT_INHALE_START, timestampMs);
+      break;
+    case BREATH_EXHALE:
+      pushEvent(BREATH_EVENT_EXHALE_START, timestampMs);
+      break;
+    case BREATH_HOLD:
+      pushEvent(BREATH_EVENT_HOLD_START, timestampMs);
+      break;
+    default:
+      break;
+  }
+}
+
+// Queue an event, overwriting the oldest one when the ring is full
+void BreathData::pushEvent(BreathEventType type, unsigned long timestampMs) {
+  BreathEvent event = { type, (uint32_t)timestampMs };
+  if (!events.push(event)) {
+    BreathEvent stale;
+    events.pop(stale);
+    events.push(event);
+  }
+}
+
+// Feed the peak of a finished inhale/exhale phase into its quantile tracker
+// and move that bound so the NORM_PEAK_QUANTILE peak lands on the overage
+// threshold. Bounds follow recent breathing both ways, so a single cough
+// only counts as one outlier peak and fades out as new peaks arrive.
+// Runs once per phase; per-sample work stays O(1).
+void BreathData::updateBounds(BreathState endedState) {
+  if (endedState == BREATH_INHALE) {
+    inhalePeaks.add(-phasePeak);
+    if (inhalePeaks.getCount() >= NORM_PEAK_MIN_COUNT) {
+      float bound = inhalePeaks.quantile(NORM_PEAK_QUANTILE) / NORM_OVERAGE_THRESHOLD;
+      minPressureDelta = -fmaxf(bound, NORM_MIN_BOUND_PA);
+    }
+  } else if (endedState == BREATH_EXHALE) {
+    exhalePeaks.add(phasePeak);
+    if (exhalePeaks.getCount() >= NORM_PEAK_MIN_COUNT) {
+      float bound = exhalePeaks.quantile(NORM_PEAK_QUANTILE) / NORM_OVERAGE_THRESHOLD;
+      maxPressureDelta = fmaxf(bound, NORM_MIN_BOUND_PA);
     }
+  }
+}
 
-    lastBreathTime = now;
+// Calculate normalized breath (-1 to +1)
+float BreathData::normalize(float delta) const {
+  if (delta < 0 && minPressureDelta < -0.1f) {
+    // Inhale: map [minPressureDelta..0] → [-1..0]
+    return delta / (-minPressureDelta);
+  } else if (delta > 0 && maxPressureDelta > 0.1f) {
+    // Exhale: map [0..maxPressureDelta] → [0..1]
+    return delta / maxPressureDelta;
+  }
+  return 0;
+}
+
+// Constant-velocity extrapolation of the filtered delta from the last
+// sample, normalized with the current bounds. The predictor's rate is per
+// sample, so it is scaled by the measured sample interval; the horizon is
+// capped so a stalled sensor does not run the value away.
+float BreathData::getPredictedNormalizedBreathRaw(uint32_t lookaheadMs) const {
+  if (lookaheadMs == 0) {
+    return normalizedBreathRaw;
+  }
+
+  uint32_t horizonMs = (uint32_t)(Clock::millis() - lastSampleTime) + lookaheadMs;
+  if (horizonMs > BREATH_PREDICT_MAX_MS) {
+    horizonMs = BREATH_PREDICT_MAX_MS;
   }
+  return normalize(predictor.value() + predictor.rate() * (horizonMs / sampleIntervalMs));
 }
 
 void BreathData::resetSession() {
   breathCount = 0;
-  averageBreathDuration = 0;
-  sessionStartTime = millis();
+  cycleHasInhale = false;
+  analytics.reset();
+  sessionStartTime = Clock::millis();
 }
 
 void BreathData::resetCalibration() {
-  minPressureDelta = -10.0f;
-  maxPressureDelta = 10.0f;
+  minPressureDelta = -NORM_MIN_BOUND_PA;
+  maxPressureDelta = NORM_MIN_BOUND_PA;
+  phasePeak = 0;
+  inhalePeaks.reset();
+  exhalePeaks.reset();
 }
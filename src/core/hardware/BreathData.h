@@ -2,32 +2,86 @@
 #define BREATH_DATA_H
 
 #include "config.h"
+#include "BreathAnalytics.h"
+#include "BreathFilter.h"
+#include "core/util/Clock.h"
+#include "core/util/DecayingQuantile.h"
+#include "core/util/RingBuffer.h"
+
+// Filter applied to every pressure delta before detection:
+// median-of-3 rejects single-sample spikes, then a ~4.5 Hz low-pass at
+// 100 Hz sampling removes sensor noise well above breathing rates.
+typedef FilterChain<MedianFilter<3>, IirLowPass<1, 4> > BreathSignalFilter;
+
+// Tracks the filtered delta (Pa) and its rate per sample for look-ahead:
+// alpha 1/2, beta 1/8 (close to critically damped, little rate noise)
+typedef AlphaBetaFilter<4, 1, 8> BreathPredictor;
+
+// Recent phase peak magnitudes (Pa) for the normalization bounds
+typedef DecayingQuantile<NORM_PEAK_BUCKETS> BreathPeakQuantile;
+
+// Timestamped breath state transition
+struct BreathEvent {
+  BreathEventType type;
+  uint32_t timestampMs;  // Time of the sample that caused it
+};
 
 class BreathData {
 public:
+  BreathData();
+
   // Initialize breath detection
   void init();
 
-  // Update breath detection based on current pressure
-  void detect(float pressureDelta);
+  // Update breath detection with a raw pressure sample read at timestampMs
+  // (filtered internally)
+  void detect(float pressureDelta, unsigned long timestampMs);
+
+  // Update breath detection based on current pressure (timestamped now)
+  void detect(float pressureDelta) { detect(pressureDelta, Clock::millis()); }
 
   // Reset session statistics
   void resetSession();
 
-  // Reset min/max calibration bounds
+  // Reset min/max calibration bounds and the recent peak history
   void resetCalibration();
 
+  // Take the oldest queued transition event; false when none are left.
+  // Events are queued per sample, so scenes see every transition even when
+  // it starts and ends between two frames. When nobody drains the queue the
+  // oldest events are overwritten.
+  bool pollEvent(BreathEvent& event) { return events.pop(event); }
+  // Discard queued events (e.g. before a scene starts draining)
+  void clearEvents() { events.clear(); }
+  // Events overwritten before being drained
+  uint32_t getDroppedEventCount() const { return events.getDropped(); }
+
   // Getters
   BreathState getState() const { return currentState; }
+  // No breath in progress (idle or holding): safe to track baseline drift
+  bool isQuiescent() const { return currentState == BREATH_IDLE || currentState == BREATH_HOLD; }
+  // Completed breaths (inhale then exhale) this session
   int getBreathCount() const { return breathCount; }
-  float getAverageBreathDuration() const { return averageBreathDuration; }
+  // Mean breath cycle length (ms) over the analytics window
+  float getAverageBreathDuration() const { return analytics.getMeanCycleMs(); }
   unsigned long getSessionStartTime() const { return sessionStartTime; }
   unsigned long getBreathStartTime() const { return breathStartTime; }
+  // Timestamp of the newest sample detect() consumed (latency probe tag)
+  unsigned long getLastSampleTime() const { return lastSampleTime; }
+
+  // Sliding-window breath statistics (BPM, I:E, variability, peaks)
+  const BreathAnalytics& getAnalytics() const { return analytics; }
+
+  // Pressure delta after BreathSignalFilter (Pa)
+  float getFilteredDelta() const { return filteredDelta; }
 
   // Normalized breath: -1 (max inhale) to +1 (max exhale)
   float getNormalizedBreath() const { return constrain(normalizedBreathRaw, -1.0f, 1.0f); }
   // Raw normalized breath value (may exceed -1 to +1)
   float getNormalizedBreathRaw() const { return normalizedBreathRaw; }
+  // Raw normalized breath extrapolated lookaheadMs past now (0 = no
+  // prediction), to make up for sensor-to-display latency
+  float getPredictedNormalizedBreathRaw(uint32_t lookaheadMs) const;
 
   // Calibration bounds (for diagnostics)
   float getMinDelta() const { return minPressureDelta; }
@@ -42,13 +96,34 @@ private:
   unsigned long breathStartTime = 0;
   unsigned long lastBreathTime = 0;
   int breathCount = 0;
-  float averageBreathDuration = 0;
+  bool cycleHasInhale = false;  // Inhaled since the last completed breath
   unsigned long sessionStartTime = 0;
+  BreathAnalytics analytics;
+
+  // Transition events
+  void queueTransition(BreathState from, BreathState to, unsigned long timestampMs);
+  void pushEvent(BreathEventType type, unsigned long timestampMs);
+  RingBuffer<BreathEvent, BREATH_EVENT_QUEUE_SIZE> events;
+
+  // Input filtering
+  BreathSignalFilter signalFilter;
+  float filteredDelta = 0;
 
   // Normalization
+  void updateBounds(BreathState endedState);
+
+  // Map a delta (Pa) to the normalized breath with the current bounds
+  float normalize(float delta) const;
+
   float normalizedBreathRaw = 0;
-  float minPressureDelta = -10.0f;  // Initial estimate (inhale)
-  float maxPressureDelta = 10.0f;   // Initial estimate (exhale)
+  BreathPredictor predictor;
+  unsigned long lastSampleTime = 0;
+  float sampleIntervalMs = 1000.0f / SENSOR_SAMPLE_RATE_HZ;  // Smoothed
+  float minPressureDelta = -NORM_MIN_BOUND_PA;  // Initial estimate (inhale)
+  float maxPressureDelta = NORM_MIN_BOUND_PA;   // Initial estimate (exhale)
+  float phasePeak = 0;                          // Extreme delta of the current state
+  BreathPeakQuantile inhalePeaks;
+  BreathPeakQuantile exhalePeaks;
 };
 
 // Global breath data instance (defined in main.cpp)
@@ -0,0 +1,175 @@
+#ifndef BREATH_FILTER_H
+#define BREATH_FILTER_H
+
+// Compile-time signal filter stages.
+// Each stage is a small value type with process(x) -> y and reset().
+// Coefficients are integer template arguments, so a FilterChain of stages
+// inlines into one function with constant coefficients and no virtual calls.
+
+// ========================================
+// IIR Low-Pass (single pole)
+// ========================================
+// y += (x - y) * Num / Den. Starts from 0 (a neutral delta/normalized value).
+template<int Num, int Den>
+class IirLowPass {
+public:
+  static_assert(Num > 0 && Num <= Den, "IirLowPass alpha must be in (0, 1]");
+
+  float process(float x) {
+    _y += (x - _y) * ((float)Num / Den);
+    return _y;
+  }
+
+  void reset() { _y = 0; }
+
+  // Last output
+  float value() const { return _y; }
+
+private:
+  float _y = 0;
+};
+
+// ========================================
+// Median of N
+// ========================================
+// Rejects single-sample spikes; delays edges by N/2 samples.
+template<int N>
+class MedianFilter {
+public:
+  static_assert(N >= 3 && (N & 1), "MedianFilter window must be odd and >= 3");
+
+  float process(float x) {
+    if (!_primed) {
+      // Fill the window so startup does not pull toward 0
+      for (int i = 0; i < N; i++) _window[i] = x;
+      _primed = true;
+    }
+    _window[_head] = x;
+    _head = (_head + 1) % N;
+
+    // Insertion sort of a copy; N is tiny
+    float sorted[N];
+    for (int i = 0; i < N; i++) {
+      float v = _window[i];
+      int j = i;
+      while (j > 0 && sorted[j - 1] > v) {
+        sorted[j] = sorted[j - 1];
+        j--;
+      }
+      sorted[j] = v;
+    }
+    return sorted[N / 2];
+  }
+
+  void reset() {
+    _head = 0;
+    _primed = false;
+  }
+
+private:
+  float _window[N];
+  int _head = 0;
+  bool _primed = false;
+};
+
+// ========================================
+// Moving Average of N
+// ========================================
+template<int N>
+class MovingAverage {
+public:
+  static_assert(N >= 1, "MovingAverage window must be >= 1");
+
+  MovingAverage() { reset(); }
+
+  float process(float x) {
+    _sum += x - _window[_head];
+    _window[_head] = x;
+    _head = (_head + 1) % N;
+    return _sum / N;
+  }
+
+  void reset() {
+    for (int i = 0; i < N; i++) _window[i] = 0;
+    _sum = 0;
+    _head = 0;
+  }
+
+private:
+  float _window[N];
+  float _sum;
+  int _head;
+};
+
+// ========================================
+// Alpha-Beta Tracker
+// ========================================
+// Tracks value and rate (per sample). Alpha and beta are AlphaNum/Den and
+// BetaNum/Den. Less lag than a low-pass of similar smoothing on ramps.
+template<int AlphaNum, int BetaNum, int Den>
+class AlphaBetaFilter {
+public:
+  static_assert(AlphaNum > 0 && AlphaNum <= Den && BetaNum >= 0 && BetaNum <= Den,
+                "AlphaBetaFilter gains must be in [0, 1]");
+
+  float process(float x) {
+    float predicted = _value + _rate;
+    float residual = x - predicted;
+    _value = predicted + residual * ((float)AlphaNum / Den);
+    _rate += residual * ((float)BetaNum / Den);
+    return _value;
+  }
+
+  void reset() {
+    _value = 0;
+    _rate = 0;
+  }
+
+  float value() const { return _value; }
+
+  // Estimated change per sample
+  float rate() const { return _rate; }
+
+private:
+  float _value = 0;
+  float _rate = 0;
+};
+
+// ========================================
+// Filter Chain
+// ========================================
+// FilterChain<A, B, C>::process(x) == C.process(B.process(A.process(x)))
+template<typename... Stages>
+class FilterChain;
+
+template<>
+class FilterChain<> {
+public:
+  float process(float x) { return x; }
+  void reset() {}
+};
+
+template<typename First, typename... Rest>
+class FilterChain<First, Rest...> {
+public:
+  float process(float x) { return _rest.process(_first.process(x)); }
+
+  void reset() {
+    _first.reset();
+    _rest.reset();
+  }
+
+  // First stage (for stage-specific getters such as rate())
+  First& first() { return _first; }
+  const First& first() const { return _first; }
+
+  // Remaining stages
+  FilterChain<Rest...>& rest() { return _rest; }
+  const FilterChain<Rest...>& rest() const { return _rest; }
+
+private:
+  First _first;
+  FilterChain<Rest...> _rest;
+};
+
+#endif // BREATH_FILTER_H
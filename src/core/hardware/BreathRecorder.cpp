@@ -0,0 +1,88 @@
+// Platform-independent BreathRecorder: encoding, buffering and flushing.
+// The file backend (openFile/writeFile/closeFile) is per platform:
+// BreathRecorderSpiffs.cpp on the device, simulator/BreathRecorder.cpp.
+#include "BreathRecorder.h"
+#include "core/util/Clock.h"
+
+#ifndef SIMULATOR
+  #include <Arduino.h>
+#else
+  #include "Platform.h"
+  extern SerialMock Serial;
+#endif
+
+void BreathRecorder::begin(int sampleRateHz) {
+  if (!openFile()) {
+    return;
+  }
+
+  _codec.reset();
+  _used = BreathRecordCodec::writeHeader(_buffer, (uint16_t)sampleRateHz);
+  _sampleCount = 0;
+  _bytesWritten = 0;
+  _startMs = Clock::millis();
+  _lastFlushMs = _startMs;
+  _recording = true;
+}
+
+void BreathRecorder::record(const PressureSample& sample) {
+  if (!_recording) {
+    return;
+  }
+  if (_used + BREATH_RECORD_MAX_SAMPLE_SIZE > BUFFER_SIZE) {
+    flush();
+    if (!_recording) return;
+  }
+  _used += _codec.encode(sample, _buffer + _used);
+  _sampleCount++;
+}
+
+void BreathRecorder::service(unsigned long nowMs) {
+  if (!_recording) {
+    return;
+  }
+#ifndef SIMULATOR
+  // The device loop never returns, so nothing else would call end()
+  if (SESSION_RECORD_MAX_S > 0 && nowMs - _startMs >= SESSION_RECORD_MAX_S * 1000UL) {
+    end();
+    Serial.println("Session recording complete");
+    return;
+  }
+#endif
+  if (nowMs - _lastFlushMs >= SESSION_RECORD_FLUSH_MS) {
+    _lastFlushMs = nowMs;
+    flush();
+  }
+}
+
+void BreathRecorder::flush() {
+  if (_used == 0) {
+    return;
+  }
+  size_t written = writeFile(_buffer, _used);
+  _bytesWritten += written;
+  if (written != _used) {
+    // Storage full or file gone: keep what fits and stop
+    Serial.println("Session recording stopped: write failed");
+    _recording = false;
+    closeFile();
+  }
+  _used = 0;
+}
+
+void BreathRecorder::end() {
+  if (!_recording) {
+    return;
+  }
+  flush();
+  if (_recording) {
+    closeFile();
+    _recording = false;
+  }
+
+  Serial.print("Recorded ");
+  Serial.print((int)_sampleCount);
+  Serial.print(" samples, ");
+  Serial.print((int)_bytesWritten);
+  Serial.println(" bytes");
+}
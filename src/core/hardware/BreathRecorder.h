@@ -0,0 +1,74 @@
+#ifndef BREATH_RECORDER_H
+#define BREATH_RECORDER_H
+
+#include "config.h"
+#include "BreathRecording.h"
+
+#ifdef SIMULATOR
+  #include <stdio.h>
+#else
+  #include <FS.h>
+#endif
+
+// Streams sensor samples to a BreathRecording file.
+// Device: SESSION_RECORD_PATH on SPIFFS when SESSION_RECORDING is 1.
+// Simulator: the path in the SPIRO_RECORD environment variable.
+// record() only appends to a RAM buffer. service() writes it out every
+// SESSION_RECORD_FLUSH_MS from the main loop's idle time (never from the
+// sampling task or mid-frame), so a power cut loses at most about that much.
+// The device loop never returns, so service() also ends the recording after
+// SESSION_RECORD_MAX_S.
+// BreathRecorder.cpp holds the shared logic; only the file backend differs
+// per platform (BreathRecorderSpiffs.cpp, simulator/BreathRecorder.cpp).
+class BreathRecorder {
+public:
+  // Open the destination and write the header (no-op when recording is off)
+  void begin(int sampleRateHz = SENSOR_SAMPLE_RATE_HZ);
+
+  // Append one sample (call for each sample drained from the sensor)
+  void record(const PressureSample& sample);
+
+  // Periodic flush and the recording time limit (call once per main loop,
+  // after the scene frame)
+  void service(unsigned long nowMs);
+
+  // Flush and close
+  void end();
+
+  bool isRecording() const { return _recording; }
+  uint32_t getSampleCount() const { return _sampleCount; }
+  uint32_t getBytesWritten() const { return _bytesWritten; }
+
+private:
+  // Several seconds of typical samples, so service() flushes before it fills
+  static const size_t BUFFER_SIZE = 2048;
+
+  // Write the buffer out; stops the recording on a short write
+  void flush();
+
+  // File backend (per platform). openFile() reports why it failed and
+  // returns false when recording is off; writeFile() returns bytes written.
+  bool openFile();
+  size_t writeFile(const uint8_t* data, size_t length);
+  void closeFile();
+
+  BreathRecordCodec _codec;
+  uint8_t _buffer[BUFFER_SIZE];
+  size_t _used = 0;
+  bool _recording = false;
+  uint32_t _sampleCount = 0;
+  uint32_t _bytesWritten = 0;
+  unsigned long _startMs = 0;
+  unsigned long _lastFlushMs = 0;
+
+#ifdef SIMULATOR
+  FILE* _file = nullptr;
+#else
+  fs::File _file;
+#endif
+};
+
+// Global recorder instance (defined in main.cpp)
+extern BreathRecorder breathRecorder;
+
+#endif // BREATH_RECORDER_H
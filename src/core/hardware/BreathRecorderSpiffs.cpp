@@ -0,0 +1,36 @@
+// Device file backend for BreathRecorder (SPIFFS)
+#include "BreathRecorder.h"
+#include <Arduino.h>
+#include <SPIFFS.h>
+
+bool BreathRecorder::openFile() {
+#if SESSION_RECORDING
+  // Format on first use so a fresh board can record
+  if (!SPIFFS.begin(true)) {
+    Serial.println("Session recording disabled: SPIFFS mount failed");
+    return false;
+  }
+
+  _file = SPIFFS.open(SESSION_RECORD_PATH, FILE_WRITE);
+  if (!_file) {
+    Serial.println("Session recording disabled: cannot open file");
+    return false;
+  }
+
+  Serial.print("Recording session to ");
+  Serial.println(SESSION_RECORD_PATH);
+  return true;
+#else
+  return false;
+#endif
+}
+
+size_t BreathRecorder::writeFile(const uint8_t* data, size_t length) {
+  size_t written = _file.write(data, length);
+  _file.flush();
+  return written;
+}
+
+void BreathRecorder::closeFile() {
+  _file.close();
+}
@@ -0,0 +1,123 @@
+#ifndef BREATH_RECORDING_H
+#define BREATH_RECORDING_H
+
+#include "PressureSample.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary breath session format (little endian):
+//   header: "BREC", version (u8), reserved (u8), sample rate Hz (u16)
+//   sample: varint   timestamp delta (ms)
+//           zigzag   pressure delta (0.01 Pa)
+//           zigzag   temperature delta (0.01 C)
+// Deltas are against the previous sample (zero before the first), so a
+// steady 100 Hz trace costs ~3-4 bytes per sample instead of 12.
+static const uint8_t BREATH_RECORD_VERSION = 1;
+static const size_t BREATH_RECORD_HEADER_SIZE = 8;
+static const size_t BREATH_RECORD_MAX_SAMPLE_SIZE = 15;  // 3 varints of <= 5 bytes
+
+// Delta encoder/decoder state. Use one instance per stream direction.
+class BreathRecordCodec {
+public:
+  BreathRecordCodec() { reset(); }
+
+  // Start a new stream (before the first sample)
+  void reset() {
+    _lastTimestamp = 0;
+    _lastPressure = 0;
+    _lastTemperature = 0;
+  }
+
+  // Write the stream header; returns BREATH_RECORD_HEADER_SIZE
+  static size_t writeHeader(uint8_t* out, uint16_t sampleRateHz) {
+    out[0] = 'B';
+    out[1] = 'R';
+    out[2] = 'E';
+    out[3] = 'C';
+    out[4] = BREATH_RECORD_VERSION;
+    out[5] = 0;
+    out[6] = (uint8_t)(sampleRateHz & 0xFF);
+    out[7] = (uint8_t)(sampleRateHz >> 8);
+    return BREATH_RECORD_HEADER_SIZE;
+  }
+
+  // Validate a stream header and read its sample rate
+  static bool readHeader(const uint8_t* data, size_t length, uint16_t& sampleRateHz) {
+    if (length < BREATH_RECORD_HEADER_SIZE ||
+        data[0] != 'B' || data[1] != 'R' || data[2] != 'E' || data[3] != 'C' ||
+        data[4] != BREATH_RECORD_VERSION) {
+      return false;
+    }
+    sampleRateHz = (uint16_t)(data[6] | (data[7] << 8));
+    return true;
+  }
+
+  // Encode one sample; returns bytes written (<= BREATH_RECORD_MAX_SAMPLE_SIZE)
+  size_t encode(const PressureSample& sample, uint8_t* out) {
+    int32_t pressure = (int32_t)lroundf(sample.pressure * 100.0f);
+    int32_t temperature = (int32_t)lroundf(sample.temperature * 100.0f);
+
+    size_t n = 0;
+    n += writeVarint(out + n, sample.timestampMs - _lastTimestamp);
+    n += writeVarint(out + n, zigzag(pressure - _lastPressure));
+    n += writeVarint(out + n, zigzag(temperature - _lastTemperature));
+
+    _lastTimestamp = sample.timestampMs;
+    _lastPressure = pressure;
+    _lastTemperature = temperature;
+    return n;
+  }
+
+  // Decode one sample; returns bytes consumed, 0 at end of data or if truncated
+  size_t decode(const uint8_t* data, size_t length, PressureSample& sample) {
+    uint32_t dt, dp, dtemp;
+    size_t n = 0, used;
+    if (!(used = readVarint(data + n, length - n, dt))) return 0;
+    n += used;
+    if (!(used = readVarint(data + n, length - n, dp))) return 0;
+    n += used;
+    if (!(used = readVarint(data + n, length - n, dtemp))) return 0;
+    n += used;
+
+    _lastTimestamp += dt;
+    _lastPressure += unzigzag(dp);
+    _lastTemperature += unzigzag(dtemp);
+
+    sample.timestampMs = _lastTimestamp;
+    sample.pressure = _lastPressure / 100.0f;
+    sample.temperature = _lastTemperature / 100.0f;
+    return n;
+  }
+
+private:
+  static uint32_t zigzag(int32_t v) { return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+  static int32_t unzigzag(uint32_t v) { return (int32_t)(v >> 1) ^ -(int32_t)(v & 1); }
+
+  static size_t writeVarint(uint8_t* out, uint32_t v) {
+    size_t n = 0;
+    while (v >= 0x80) {
+      out[n++] = (uint8_t)(v | 0x80);
+      v >>= 7;
+    }
+    out[n++] = (uint8_t)v;
+    return n;
+  }
+
+  static size_t readVarint(const uint8_t* data, size_t length, uint32_t& v) {
+    v = 0;
+    for (size_t i = 0; i < length && i < 5; i++) {
+      v |= (uint32_t)(data[i] & 0x7F) << (7 * i);
+      if (!(data[i] & 0x80)) {
+        return i + 1;
+      }
+    }
+    return 0;
+  }
+
+  uint32_t _lastTimestamp;
+  int32_t _lastPressure;     // 0.01 Pa
+  int32_t _lastTemperature;  // 0.01 C
+};
+
+#endif // BREATH_RECORDING_H
@@ -1,5 +1,6 @@
 #include "Display.h"
 #include "config.h"
+#include "core/util/Clock.h"
 
 #ifndef SIMULATOR
   #include <Arduino.h>
@@ -7,17 +8,44 @@
   #include "Platform.h"
 #endif
 
+#if DISPLAY_ASYNC_BLIT && defined(SIMULATOR)
+Display::~Display() {
+  {
+    std::lock_guard<std::mutex> lock(_blitMutex);
+    _blitExit = true;
+  }
+  _blitCond.notify_all();
+  if (_blitThread.joinable()) {
+    _blitThread.join();
+  }
+}
+#endif
+
 void Display::init() {
   Serial.println("Initializing display...");
 
+#ifndef HEADLESS
   _lcd.init();
   _lcd.setRotation(0);
   _lcd.fillScreen(TFT_BLACK);
+#endif
 
-  // Create sprite (canvas) for double-buffering
-  _canvas.setColorDepth(16);
-  _canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT);
+  // Create sprites (canvases) for double-buffering
+  for (Canvas& canvas : _canvas) {
+    canvas.setColorDepth(16);
+    canvas.createSprite(SCREEN_WIDTH, SCREEN_HEIGHT);
+  }
+  invalidate();
 
+#if DISPLAY_ASYNC_BLIT
+  #ifdef SIMULATOR
+  _blitThread = std::thread(&Display::blitWorker, this);
+  #else
+  // Keep the SPI bus claimed so DMA transfers can run across frames
+  _lcd.initDMA();
+  _lcd.startWrite();
+  #endif
+#endif
 
   Serial.println("Display initialized");
 }
@@ -27,13 +55,138 @@ LGFX& Display::getLcd() {
 }
 
 Canvas& Display::getCanvas() {
-  return _canvas;
+  return _canvas[_backBuffer];
+}
+
+bool Display::rowChanged(const uint16_t* pixels, int y) {
+  // FNV-1a over the row, two pixels per step
+  const uint32_t* row = (const uint32_t*)(pixels + y * SCREEN_WIDTH);
+  uint32_t hash = 2166136261u;
+  for (int i = 0; i < SCREEN_WIDTH / 2; i++) {
+    hash = (hash ^ row[i]) * 16777619u;
+  }
+
+  bool changed = _fullRedraw || hash != _rowHash[y];
+  _rowHash[y] = hash;
+  return changed;
+}
+
+void Display::collectDirtySpans(const uint16_t* pixels) {
+  _pushPixels = pixels;
+  _spanCount = 0;
+  _lastBlitRows = 0;
+
+  int y = 0;
+  while (y < SCREEN_HEIGHT) {
+    if (!rowChanged(pixels, y)) {
+      y++;
+      continue;
+    }
+
+    int spanStart = y++;
+    while (y < SCREEN_HEIGHT && rowChanged(pixels, y)) {
+      y++;
+    }
+    _spans[_spanCount].y = spanStart;
+    _spans[_spanCount].height = y - spanStart;
+    _spanCount++;
+    _lastBlitRows += y - spanStart;
+  }
+  _fullRedraw = false;
+
+#if DISPLAY_ASYNC_BLIT && !defined(SIMULATOR)
+  // Only one DMA transfer can be in flight: queueing several spans would
+  // block on all but the last, so push the bounding span instead
+  if (_spanCount > 1) {
+    RowSpan& last = _spans[_spanCount - 1];
+    _spans[0].height = last.y + last.height - _spans[0].y;
+    _spanCount = 1;
+    _lastBlitRows = _spans[0].height;
+  }
+#endif
+}
+
+void Display::pushSpans() {
+#ifdef HEADLESS
+  // No panel: stand in for the SPI transfer time so blits can be benchmarked
+  long long bits = (long long)_lastBlitRows * SCREEN_WIDTH * 16;
+  std::this_thread::sleep_for(std::chrono::microseconds(bits * 1000000LL / DISPLAY_SPI_HZ));
+#else
+  _lcd.startWrite();
+  for (int i = 0; i < _spanCount; i++) {
+    const RowSpan& span = _spans[i];
+    _lcd.pushImage(0, span.y, SCREEN_WIDTH, span.height,
+                   (const lgfx::swap565_t*)(_pushPixels + span.y * SCREEN_WIDTH));
+  }
+  _lcd.endWrite();
+#endif
 }
 
+#if DISPLAY_ASYNC_BLIT && defined(SIMULATOR)
+void Display::blitWorker() {
+  std::unique_lock<std::mutex> lock(_blitMutex);
+  while (true) {
+    _blitCond.wait(lock, [this] { return _blitPending || _blitExit; });
+    if (!_blitPending) {
+      return;
+    }
+
+    lock.unlock();
+    pushSpans();
+  #if LATENCY_PROBE
+    frameShown(_transferTag);
+  #endif
+    lock.lock();
+
+    _blitPending = false;
+    _blitCond.notify_all();
+  }
+}
+#endif
+
 void Display::blit() {
-  _canvas.pushSprite(&_lcd, 0, 0);
+  // The previous transfer still reads _spans and its buffer
+  waitBlit();
 
-#ifdef SIMULATOR
+  // Push only runs of rows whose contents changed since the last blit.
+  // Mostly-static scenes (text, HUDs) then cost a fraction of a full
+  // 32 KB SPI transfer.
+  collectDirtySpans((const uint16_t*)_canvas[_backBuffer].getBuffer());
+
+#if DISPLAY_ASYNC_BLIT
+  if (_spanCount > 0) {
+  #if LATENCY_PROBE
+    _transferTag = _frameTag;
+    _transferTagged = true;
+  #endif
+  #ifdef SIMULATOR
+    {
+      std::lock_guard<std::mutex> lock(_blitMutex);
+      _blitPending = true;
+    }
+    _blitCond.notify_all();
+  #else
+    const RowSpan& span = _spans[0];
+    _lcd.pushImageDMA(0, span.y, SCREEN_WIDTH, span.height,
+                      (const lgfx::swap565_t*)(_pushPixels + span.y * SCREEN_WIDTH));
+  #endif
+  }
+  #if LATENCY_PROBE
+  else {
+    frameShown(_frameTag);  // Nothing changed: already on the panel
+  }
+  #endif
+
+  // Scene draws the next frame into the other canvas while this one is sent
+  _backBuffer ^= 1;
+#else
+  pushSpans();
+  #if LATENCY_PROBE
+  frameShown(_frameTag);
+  #endif
+#endif
+
+#if defined(SIMULATOR) && !defined(HEADLESS)
   // Configure window on first blit
   static bool windowConfigured = false;
   if (!windowConfigured) {
@@ -50,18 +203,48 @@ void Display::blit() {
 #endif
 }
 
+void Display::waitBlit() {
+#if DISPLAY_ASYNC_BLIT
+  #ifdef SIMULATOR
+  std::unique_lock<std::mutex> lock(_blitMutex);
+  _blitCond.wait(lock, [this] { return !_blitPending; });
+  #else
+  _lcd.waitDMA();
+    #if LATENCY_PROBE
+  if (_transferTagged) {
+    _transferTagged = false;
+    frameShown(_transferTag);
+  }
+    #endif
+  #endif
+#endif
+}
+
+#if LATENCY_PROBE
+void Display::frameShown(uint32_t tag) {
+  ShownFrame frame = { tag, Clock::millis() };
+  _shownFrames.push(frame);  // Dropped (and counted) if nobody drains them
+}
+#endif
+
 void Display::clear() {
+  waitBlit();
+#ifndef HEADLESS
   _lcd.fillScreen(TFT_BLACK);
+#endif
+  invalidate();
 }
 
 void Display::showMessage(const char* message, uint16_t color) {
+  waitBlit();
+#ifdef HEADLESS
+  Serial.println(message);
+#else
   _lcd.fillScreen(TFT_BLACK);
   _lcd.setCursor(10, SCREEN_HEIGHT / 2 - 10);
   _lcd.setTextColor(color);
   _lcd.setTextSize(1);
   _lcd.print(message);
-}
-
-uint16_t Display::rgb565(uint8_t r, uint8_t g, uint8_t b) {
-  return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+#endif
+  invalidate();
 }
@@ -2,6 +2,17 @@
 #define DISPLAY_H
 
 #include "LGFX_Config.hpp"
+#include "core/gfx/Color565.h"
+
+#if LATENCY_PROBE
+  #include "core/util/RingBuffer.h"
+#endif
+
+#if DISPLAY_ASYNC_BLIT && defined(SIMULATOR)
+  #include <condition_variable>
+  #include <mutex>
+  #include <thread>
+#endif
 
 // Color definitions (LovyanGFX compatible)
 #define TFT_BLACK       0x0000
@@ -17,18 +28,52 @@
 
 class Display {
 public:
+#if DISPLAY_ASYNC_BLIT && defined(SIMULATOR)
+  ~Display();
+#endif
+
   // Initialize display
   void init();
 
-  // Get reference to canvas for double-buffered drawing
+  // Get reference to canvas for double-buffered drawing.
+  // With DISPLAY_ASYNC_BLIT this is the back buffer, which still holds the
+  // frame from two blits ago: scenes must redraw the whole screen.
   Canvas& getCanvas();
 
   // Get reference to LCD for direct access
   LGFX& getLcd();
 
-  // Blit canvas to display
+  // Blit canvas to display (only rows that changed since the last blit).
+  // With DISPLAY_ASYNC_BLIT this only starts the transfer and swaps buffers.
   void blit();
 
+  // Block until the last blit has reached the panel
+  void waitBlit();
+
+  // Force the next blit to push the full frame
+  // (needed after drawing to the LCD directly)
+  void invalidate() { _fullRedraw = true; }
+
+#if LATENCY_PROBE
+  // Tag the frame handed to the next blit() (see LatencyProbe)
+  void tagFrame(uint32_t tag) { _frameTag = tag; }
+
+  // Oldest tagged frame whose pixels have reached the panel, with the
+  // Clock::millis() time the transfer completed; false when none.
+  // ESP32 DMA completion is only noticed at the next waitBlit(), so there
+  // it is an upper bound (by up to a frame).
+  bool pollShownFrame(uint32_t& tag, uint32_t& shownMs) {
+    ShownFrame frame;
+    if (!_shownFrames.pop(frame)) return false;
+    tag = frame.tag;
+    shownMs = frame.shownMs;
+    return true;
+  }
+#endif
+
+  // Number of rows pushed by the last blit (for diagnostics/benchmarks)
+  int getLastBlitRows() const { return _lastBlitRows; }
+
   // Clear screen to black
   void clear();
 
@@ -36,11 +81,65 @@ public:
   void showMessage(const char* message, uint16_t color);
 
   // Convert RGB to 565 format
-  static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b);
+  static uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) { return ::rgb565(r, g, b); }
 
 private:
+  // Run of consecutive changed rows
+  struct RowSpan {
+    int16_t y;
+    int16_t height;
+  };
+
+  // Hash a canvas row and compare it with the hash last pushed for that row
+  bool rowChanged(const uint16_t* pixels, int y);
+
+  // Fill _spans with the changed rows of a frame
+  void collectDirtySpans(const uint16_t* pixels);
+
+  // Push _spans of _pushPixels to the panel (blocking)
+  void pushSpans();
+
   LGFX _lcd;
-  Canvas _canvas;
+
+  // Ping-pong canvases when blits are asynchronous
+  Canvas _canvas[DISPLAY_ASYNC_BLIT ? 2 : 1];
+  int _backBuffer = 0;
+
+  // Dirty-row tracking: hash of each row as currently shown on the panel
+  uint32_t _rowHash[SCREEN_HEIGHT];
+  bool _fullRedraw = true;
+  int _lastBlitRows = 0;
+
+  // Spans of the frame being pushed
+  RowSpan _spans[SCREEN_HEIGHT / 2 + 1];
+  int _spanCount = 0;
+  const uint16_t* _pushPixels = nullptr;
+
+#if LATENCY_PROBE
+  struct ShownFrame {
+    uint32_t tag;
+    uint32_t shownMs;
+  };
+
+  // Report a tagged frame as on the panel now. Called by one thread at a
+  // time (the blit worker hands over through waitBlit()), as the ring needs.
+  void frameShown(uint32_t tag);
+
+  RingBuffer<ShownFrame, 8> _shownFrames;
+  uint32_t _frameTag = 0;     // Frame being drawn / handed to blit()
+  uint32_t _transferTag = 0;  // Frame being transferred
+  bool _transferTagged = false;
+#endif
+
+#if DISPLAY_ASYNC_BLIT && defined(SIMULATOR)
+  // Simulator stand-in for DMA: a worker thread performs the push
+  void blitWorker();
+  std::thread _blitThread;
+  std::mutex _blitMutex;
+  std::condition_variable _blitCond;
+  bool _blitPending = false;
+  bool _blitExit = false;
+#endif
 };
 
 // Global display instance (defined in main.cpp)
@@ -0,0 +1,13 @@
+#ifndef PRESSURE_SAMPLE_H
+#define PRESSURE_SAMPLE_H
+
+#include <stdint.h>
+
+// One timestamped reading from the sampling task
+struct PressureSample {
+  uint32_t timestampMs;  // Clock::millis() when the sample was read
+  float pressure;        // Absolute pressure (Pa)
+  float temperature;     // Temperature (C)
+};
+
+#endif // PRESSURE_SAMPLE_H
@@ -1,64 +1,53 @@
 #include "Sensor.h"
-#include "Display.h"
 #include "config.h"
+#include "BMx280.h"
+#include "core/util/Clock.h"
 #include <Wire.h>
 
 #ifdef USE_BME280
-  #include <Adafruit_BME280.h>
-  static Adafruit_BME280 bme;
+  static const char* SENSOR_NAME = "BME280";
+  static const uint8_t SENSOR_CHIP_ID = BMx280::CHIP_ID_BME280;
 #elif defined(USE_BMP280)
-  #include <Adafruit_BMP280.h>
-  static Adafruit_BMP280 bmp;
+  static const char* SENSOR_NAME = "BMP280";
+  static const uint8_t SENSOR_CHIP_ID = BMx280::CHIP_ID_BMP280;
 #else
   #error "Must define either USE_BME280 or USE_BMP280"
 #endif
 
-void Sensor::init() {
-#ifdef USE_BME280
-  Serial.println("Initializing BME280 sensor...");
-  delay(100);
-
-  unsigned status = bme.begin(0x76);
-  if (!status) {
-    Serial.println("ERROR: Could not find BME280 sensor at 0x76!");
-    Serial.print("SensorID was: 0x");
-    Serial.println(bme.sensorID(), HEX);
+static BMx280 chip;
 
-    Serial.println("Trying alternate address 0x77...");
-    status = bme.begin(0x77);
-    if (!status) {
-      Serial.println("Failed at 0x77 too!");
-      Serial.println("ID of 0xFF = bad address or BMP180/BMP085");
-      Serial.println("ID of 0x56-0x58 = BMP280");
-      Serial.println("ID of 0x60 = BME280");
-      while (1) delay(100);
-    }
+// Read one compensated sample (single I2C burst, integer compensation)
+static bool readChip(float& pressure, float& temperature) {
+  int32_t centiCelsius;
+  uint32_t pressureQ8;
+  if (!chip.read(centiCelsius, pressureQ8)) {
+    return false;
   }
+  pressure = pressureQ8 * (1.0f / 256.0f);
+  temperature = centiCelsius * 0.01f;
+  return true;
+}
 
-  Serial.println("BME280 initialized successfully!");
-
-  // Configure BME280 for high precision
-  bme.setSampling(Adafruit_BME280::MODE_NORMAL,
-                  Adafruit_BME280::SAMPLING_X16,  // Pressure oversampling
-                  Adafruit_BME280::SAMPLING_X2,   // Temperature oversampling
-                  Adafruit_BME280::SAMPLING_NONE, // Humidity (not needed)
-                  Adafruit_BME280::FILTER_X16,    // Filtering
-                  Adafruit_BME280::STANDBY_MS_0_5); // Standby time
-
-#elif defined(USE_BMP280)
-  Serial.println("Initializing BMP280 sensor...");
+void Sensor::init() {
+  Serial.print("Initializing ");
+  Serial.print(SENSOR_NAME);
+  Serial.println(" sensor...");
   delay(100);
 
-  // Initialize BMP280 - specify chip ID explicitly for GY-BMP280 clones
-  unsigned status = bmp.begin(0x76, 0x58);
-  if (!status) {
-    Serial.println("ERROR: Could not find BMP280 sensor at 0x76!");
+  Wire.begin(BMP_SDA, BMP_SCL);
+  Wire.setClock(400000);  // Fast mode: a 6-byte burst takes ~0.25 ms
+
+  bool found = chip.begin(0x76, SENSOR_CHIP_ID);
+  if (!found) {
+    Serial.print("ERROR: Could not find ");
+    Serial.print(SENSOR_NAME);
+    Serial.println(" sensor at 0x76!");
     Serial.print("SensorID was: 0x");
-    Serial.println(bmp.sensorID(), HEX);
+    Serial.println(chip.getChipId(), HEX);
 
-    Serial.println("Trying alternate address 0x77 with chip ID 0x58...");
-    status = bmp.begin(0x77, 0x58);
-    if (!status) {
+    Serial.println("Trying alternate address 0x77...");
+    found = chip.begin(0x77, SENSOR_CHIP_ID);
+    if (!found) {
       Serial.println("Failed at 0x77 too!");
       Serial.println("ID of 0xFF = bad address or BMP180/BMP085");
       Serial.println("ID of 0x56-0x58 = BMP280");
@@ -67,49 +56,75 @@ void Sensor::init() {
     }
   }
 
-  Serial.println("BMP280 initialized successfully!");
-
-  // Configure BMP280 for high precision
-  bmp.setSampling(Adafruit_BMP280::MODE_NORMAL,
-                  Adafruit_BMP280::SAMPLING_X16,  // Pressure oversampling
-                  Adafruit_BMP280::SAMPLING_X2,   // Temperature oversampling
-                  Adafruit_BMP280::FILTER_X16,    // Filtering
-                  Adafruit_BMP280::STANDBY_MS_1); // Standby time
-#endif
+  Serial.print(SENSOR_NAME);
+  Serial.println(" initialized successfully!");
+
+  // Configure for ~110 Hz output (8.7 ms measurement + 0.5 ms standby)
+  // so the sampling task gets a fresh reading every period; the IIR filter
+  // makes up for the lower oversampling
+  chip.configure(BMx280::OVERSAMPLING_X2,   // Pressure oversampling
+                 BMx280::OVERSAMPLING_X1,   // Temperature oversampling
+                 BMx280::FILTER_X16,        // Filtering
+                 BMx280::STANDBY_MS_0_5);   // Standby time
+  delay(20);  // Let the first measurement complete
 }
 
-void Sensor::calibrateBaseline() {
-  Serial.println("Calibrating baseline pressure...");
+void Sensor::startSampling(int rateHz) {
+  _sampleRateHz = rateHz;
+  _baseline.reset(rateHz);
 
-  display.showMessage("Calibrating...\n  Breathe\n  normally", TFT_CYAN);
+  Serial.print("Starting sensor sampling task at ");
+  Serial.print(rateHz);
+  Serial.println(" Hz");
 
-  // Take average of 50 readings
-  float sum = 0;
-  for (int i = 0; i < 50; i++) {
-#ifdef USE_BME280
-    sum += bme.readPressure();
-#else
-    sum += bmp.readPressure();
-#endif
-    delay(20);
-  }
+  // Pinned to the core not running loop(), so rendering cost does not add
+  // jitter to the sample timing
+  // (priority 2: above the Arduino loop task)
+  xTaskCreatePinnedToCore(samplingTaskEntry, "sensor", 4096, this,
+                          2, nullptr, SENSOR_TASK_CORE);
+}
 
-  baselinePressure = sum / 50.0f;
+void Sensor::samplingTaskEntry(void* sensor) {
+  static_cast<Sensor*>(sensor)->samplingLoop();
+}
 
-  Serial.print("Baseline pressure: ");
-  Serial.print(baselinePressure);
-  Serial.println(" Pa");
+void Sensor::samplingLoop() {
+  // Wake on an accumulated microsecond deadline: tick periods are whole
+  // milliseconds, so rates that do not divide 1000 (e.g. 150 Hz) keep their
+  // average rate with at most a tick of jitter per sample
+  const uint32_t periodUs = 1000000u / _sampleRateHz;
+  uint32_t nextWakeUs = micros();
+
+  while (true) {
+    PressureSample sample;
+    sample.timestampMs = Clock::millis();
+    if (readChip(sample.pressure, sample.temperature)) {
+      _samples.push(sample);
+    }
 
-  display.clear();
+    nextWakeUs += periodUs;
+    int32_t waitUs = (int32_t)(nextWakeUs - micros());
+    if (waitUs < -(int32_t)periodUs) {
+      // Fell more than a period behind (stalled bus): resync, don't burst
+      nextWakeUs = micros();
+      waitUs = 0;
+    }
+    // At least one tick, so the idle task on this core still runs
+    TickType_t ticks = pdMS_TO_TICKS((waitUs + 500) / 1000);
+    vTaskDelay(ticks > 0 ? ticks : 1);
+  }
 }
 
-void Sensor::update() {
-#ifdef USE_BME280
-  currentPressure = bme.readPressure();
-  currentTemperature = bme.readTemperature();
-#else
-  currentPressure = bmp.readPressure();
-  currentTemperature = bmp.readTemperature();
-#endif
-  pressureDelta = currentPressure - baselinePressure;
+bool Sensor::poll() {
+  PressureSample sample;
+  if (!_samples.pop(sample)) {
+    return false;
+  }
+
+  sampleTime = sample.timestampMs;
+  currentPressure = sample.pressure;
+  currentTemperature = sample.temperature;
+  // The very first sample defines the provisional baseline
+  pressureDelta = _baseline.hasSamples() ? currentPressure - _baseline.getBaseline() : 0;
+  return true;
 }
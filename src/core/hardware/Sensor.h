@@ -1,16 +1,45 @@
 #ifndef SENSOR_H
 #define SENSOR_H
 
+#include "config.h"
+#include "BaselineTracker.h"
+#include "PressureSample.h"
+#include "core/util/RingBuffer.h"
+
+#ifdef SIMULATOR
+  #include "BreathRecording.h"
+  #include <atomic>
+  #include <thread>
+  #include <vector>
+#endif
+
 class Sensor {
 public:
+#ifdef SIMULATOR
+  ~Sensor();
+#endif
+
   // Initialize sensor
   void init();
 
-  // Calibrate baseline pressure (call once at startup)
-  void calibrateBaseline();
+  // Start the background sampling task (FreeRTOS task pinned to
+  // SENSOR_TASK_CORE on ESP32, std::thread in the simulator). Samples are
+  // read at a fixed rate and queued for poll().
+  // The baseline calibrates online from the first samples, so the game can
+  // start right away.
+  void startSampling(int rateHz = SENSOR_SAMPLE_RATE_HZ);
+
+  // Take the oldest queued sample and make it current (call in a loop until
+  // it returns false to consume every sample since the last frame)
+  bool poll();
+
+  // Feed the current sample to the baseline tracker (call after each poll()).
+  // quiescent = no breath in progress; drift is only tracked then.
+  void trackBaseline(bool quiescent) { _baseline.update(currentPressure, quiescent); }
 
-  // Update current pressure reading (call every loop)
-  void update();
+  // Current baseline pressure (Pa) and whether the warm-up mean is complete
+  float getBaseline() const { return _baseline.getBaseline(); }
+  bool isBaselineSettled() const { return _baseline.isSettled(); }
 
   // Get raw pressure delta from baseline (in Pascals)
   float getDelta() const { return pressureDelta; }
@@ -21,19 +50,85 @@ public:
   // Get current temperature in Celsius
   float getTemperature() const { return currentTemperature; }
 
+  // Time the current sample was read (millis)
+  uint32_t getSampleTime() const { return sampleTime; }
+
+  // Current sample as read (for recording)
+  PressureSample getSample() const {
+    PressureSample sample = { sampleTime, currentPressure, currentTemperature };
+    return sample;
+  }
+
+  // Samples lost because the main loop fell behind
+  uint32_t getDroppedSamples() const { return _samples.getDropped(); }
+
 #ifdef SIMULATOR
   // Simulator only: set pressure from mouse Y position
   void setMouseY(int mouseY, int windowHeight);
+
+  // Simulator only: true when samples come from a recording (SPIRO_REPLAY)
+  bool isReplaying() const { return !_replayData.empty(); }
+
+  // Simulator only: every recorded sample has been delivered
+  bool isReplayFinished() const { return _replayFinished; }
+
+  // Simulator only: the scripted step input (SPIRO_STEP) has run all its
+  // LATENCY_STEP_COUNT steps
+  bool isStepFinished() const { return _stepFinished; }
 private:
+  // Read the mouse on the main thread (SDL is not thread-safe) and publish
+  // the pressure it maps to for the sampling thread
+  void updateMouseInput();
+
   int _mouseY = 256;      // Start at center (neutral)
   int _windowHeight = 512;
+  std::atomic<float> _mousePressureDelta{0.0f};
+  std::atomic<bool> _samplingRunning{false};
+  std::thread _samplingThread;
+
+  // Replay backend: load a BreathRecording file, then deliver its samples
+  // from poll() once Clock time reaches their recorded offsets (no thread,
+  // so a virtual clock replays faster than real time)
+  bool loadReplay(const char* path);
+  bool pollReplay(PressureSample& sample);
+
+  std::vector<uint8_t> _replayData;
+  int _replayRateHz = 0;
+  BreathRecordCodec _replayCodec;
+  size_t _replayOffset = 0;
+  uint32_t _replayStartMs = 0;
+  uint32_t _replayFirstTimestamp = 0;
+  bool _replayStarted = false;
+  bool _replayHasNext = false;
+  bool _replayFinished = false;
+  PressureSample _replayNext;
+
+  // Step backend: the input toggles between 0 and LATENCY_STEP_PA every
+  // _stepPeriodMs (a pure function of the sample time, so the sampling
+  // thread and poll() agree on where the steps are)
+  int stepLevel(uint32_t timestampMs) const;
+
+  uint32_t _stepPeriodMs = 0;
+  uint32_t _stepStartMs = 0;
+  int _stepLevel = 0;
+  bool _stepFinished = false;
+#else
+private:
+  static void samplingTaskEntry(void* sensor);
 #endif
 
 private:
-  float baselinePressure = 0;
+  // Sampling task body: reads the sensor at _sampleRateHz forever
+  void samplingLoop();
+
+  BaselineTracker _baseline;
   float currentPressure = 0;
   float currentTemperature = 0;
   float pressureDelta = 0;
+  uint32_t sampleTime = 0;
+
+  int _sampleRateHz = SENSOR_SAMPLE_RATE_HZ;
+  RingBuffer<PressureSample, SENSOR_QUEUE_SIZE> _samples;
 };
 
 // Global sensor instance (defined in main.cpp)
@@ -0,0 +1,162 @@
+#include "FrameProfiler.h"
+
+#ifndef SIMULATOR
+  #include <Arduino.h>
+#else
+  #include "Platform.h"
+#endif
+
+#include <stdio.h>
+#include <string.h>
+
+// ========================================
+// PhaseHistogram
+// ========================================
+
+void PhaseHistogram::reset() {
+  memset(_counts, 0, sizeof(_counts));
+  _count = 0;
+  _min = 0;
+  _max = 0;
+  _sum = 0;
+}
+
+int PhaseHistogram::bucketFor(uint32_t us) {
+  const uint32_t subBuckets = 1u << SUB_BUCKET_BITS;
+  if (us < subBuckets) {
+    return us;
+  }
+
+  // Octave from the highest set bit, sub-bucket from the next bits
+  int msb = 31 - __builtin_clz(us);
+  int sub = (us >> (msb - SUB_BUCKET_BITS)) & (subBuckets - 1);
+  int bucket = (msb - SUB_BUCKET_BITS + 1) * subBuckets + sub;
+  return bucket < NUM_BUCKETS ? bucket : NUM_BUCKETS - 1;
+}
+
+uint32_t PhaseHistogram::bucketValue(int bucket) {
+  const int subBuckets = 1 << SUB_BUCKET_BITS;
+  if (bucket < subBuckets) {
+    return bucket;
+  }
+
+  // Middle of the bucket's range
+  int shift = bucket / subBuckets - 1;
+  uint32_t lower = (uint32_t)(subBuckets + bucket % subBuckets) << shift;
+  return lower + ((1u << shift) >> 1);
+}
+
+void PhaseHistogram::add(uint32_t us) {
+  int bucket = bucketFor(us);
+  if (_counts[bucket] < 0xFFFF) {
+    _counts[bucket]++;
+  }
+
+  if (_count == 0 || us < _min) _min = us;
+  if (us > _max) _max = us;
+  _sum += us;
+  _count++;
+}
+
+uint32_t PhaseHistogram::getPercentile(float p) const {
+  if (_count == 0) return 0;
+
+  uint32_t target = (uint32_t)(p * _count);
+  if (target >= _count) target = _count - 1;
+
+  uint32_t seen = 0;
+  for (int i = 0; i < NUM_BUCKETS; i++) {
+    seen += _counts[i];
+    if (seen > target) {
+      // Bucket midpoint, but never outside the observed range
+      return constrain(bucketValue(i), _min, _max);
+    }
+  }
+  return _max;
+}
+
+// ========================================
+// FrameProfiler
+// ========================================
+
+void FrameProfiler::reset() {
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    _histograms[i].reset();
+    _accumulated[i] = 0;
+  }
+  _overruns = 0;
+}
+
+void FrameProfiler::beginPhase(FramePhase phase) {
+  uint32_t now = micros();
+  if (_activePhase >= 0) {
+    _accumulated[_activePhase] += now - _phaseStart;
+  }
+  _activePhase = phase;
+  _phaseStart = now;
+}
+
+void FrameProfiler::endPhase() {
+  if (_activePhase >= 0) {
+    _accumulated[_activePhase] += micros() - _phaseStart;
+    _activePhase = -1;
+  }
+}
+
+void FrameProfiler::endFrame(int fps) {
+  endPhase();
+
+  uint32_t total = 0;
+  for (int i = 0; i < PHASE_FRAME; i++) {
+    _histograms[i].add(_accumulated[i]);
+    total += _accumulated[i];
+    _accumulated[i] = 0;
+  }
+  _histograms[PHASE_FRAME].add(total);
+
+  // Work that does not fit in the scene's frame interval
+  if (fps > 0 && total > 1000000u / fps) {
+    _overruns++;
+  }
+}
+
+void FrameProfiler::dumpIfDue(unsigned long nowMs) {
+  if (PROFILER_DUMP_INTERVAL_MS == 0 || nowMs - _lastDumpMs < PROFILER_DUMP_INTERVAL_MS) {
+    return;
+  }
+  _lastDumpMs = nowMs;
+  if (getFrames() == 0) {
+    return;
+  }
+
+  // One line per window: phase avg/p95/max in microseconds
+  char line[160];
+  int len = snprintf(line, sizeof(line), "FT us avg/p95/max");
+  for (int i = 0; i < PHASE_COUNT && len < (int)sizeof(line); i++) {
+    const PhaseHistogram& h = _histograms[i];
+    len += snprintf(line + len, sizeof(line) - len, " %s %lu/%lu/%lu",
+                    getPhaseName((FramePhase)i),
+                    (unsigned long)h.getAverage(),
+                    (unsigned long)h.getPercentile(0.95f),
+                    (unsigned long)h.getMax());
+  }
+  if (len < (int)sizeof(line)) {
+    snprintf(line + len, sizeof(line) - len, " over %lu/%lu",
+             (unsigned long)_overruns, (unsigned long)getFrames());
+  }
+  Serial.println(line);
+
+  reset();
+}
+
+const char* FrameProfiler::getPhaseName(FramePhase phase) {
+  switch (phase) {
+    case PHASE_SENSOR: return "sen";
+    case PHASE_DETECT: return "det";
+    case PHASE_UPDATE: return "upd";
+    case PHASE_DRAW:   return "drw";
+    case PHASE_BLIT:   return "blt";
+    case PHASE_FRAME:  return "frm";
+    default:           return "?";
+  }
+}
@@ -0,0 +1,91 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include "config.h"
+
+// Main loop phases timed by the profiler
+enum FramePhase {
+  PHASE_SENSOR,   // Draining sensor samples
+  PHASE_DETECT,   // Breath detection
+  PHASE_UPDATE,   // Scene update
+  PHASE_DRAW,     // Scene draw
+  PHASE_BLIT,     // Display blit
+  PHASE_FRAME,    // Sum of the above for one scene frame
+  PHASE_COUNT
+};
+
+// Fixed-size log-linear histogram of microsecond durations.
+// 8 sub-buckets per power of two (~6% resolution), exact below 8 us,
+// saturating at ~260 ms. 256 bytes of counts, no allocation.
+class PhaseHistogram {
+public:
+  void reset();
+  void add(uint32_t us);
+
+  uint32_t getCount() const { return _count; }
+  uint32_t getMin() const { return _count ? _min : 0; }
+  uint32_t getMax() const { return _max; }
+  uint32_t getAverage() const { return _count ? (uint32_t)(_sum / _count) : 0; }
+
+  // Approximate percentile (p in 0..1), bucket resolution
+  uint32_t getPercentile(float p) const;
+
+private:
+  static const int SUB_BUCKET_BITS = 3;
+  static const int NUM_BUCKETS = 128;
+
+  static int bucketFor(uint32_t us);
+  static uint32_t bucketValue(int bucket);
+
+  uint16_t _counts[NUM_BUCKETS];
+  uint32_t _count = 0;
+  uint32_t _min = 0;
+  uint32_t _max = 0;
+  uint64_t _sum = 0;
+};
+
+// Lightweight per-phase frame timing.
+// loop() marks phase boundaries with beginPhase()/endPhase(); time is
+// accumulated per phase and committed to the histograms by endFrame(), so
+// sensor/detect work from loop iterations without a scene frame is charged
+// to the next frame.
+class FrameProfiler {
+public:
+  FrameProfiler() { reset(); }
+
+  // Clear histograms and counters (start a new reporting window)
+  void reset();
+
+  // Close the running phase (if any) and start timing another
+  void beginPhase(FramePhase phase);
+
+  // Close the running phase
+  void endPhase();
+
+  // Commit the accumulated phase times as one frame of a scene targeting fps
+  void endFrame(int fps);
+
+  // Print a compact summary over serial every PROFILER_DUMP_INTERVAL_MS,
+  // then start a new window
+  void dumpIfDue(unsigned long nowMs);
+
+  const PhaseHistogram& getHistogram(FramePhase phase) const { return _histograms[phase]; }
+  uint32_t getFrames() const { return _histograms[PHASE_FRAME].getCount(); }
+  uint32_t getOverruns() const { return _overruns; }
+
+  // Short label for a phase ("sen", "det", ...)
+  static const char* getPhaseName(FramePhase phase);
+
+private:
+  PhaseHistogram _histograms[PHASE_COUNT];
+  uint32_t _accumulated[PHASE_COUNT];
+  int _activePhase = -1;
+  uint32_t _phaseStart = 0;
+  uint32_t _overruns = 0;
+  unsigned long _lastDumpMs = 0;
+};
+
+// Global frame profiler instance (defined in main.cpp)
+extern FrameProfiler frameProfiler;
+
+#endif // FRAME_PROFILER_H
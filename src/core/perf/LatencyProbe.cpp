@@ -0,0 +1,91 @@
+#include "LatencyProbe.h"
+
+#ifndef SIMULATOR
+  #include <Arduino.h>
+#else
+  #include "Platform.h"
+#endif
+
+#include <math.h>
+#include <stdio.h>
+
+void LatencyProbe::reset() {
+  for (int i = 0; i < MAX_FRAMES_IN_FLIGHT; i++) {
+    _frames[i].tag = 0xFFFFFFFFu;
+  }
+  _age.reset();
+  _step.reset();
+  _stepPending = false;
+  _steps = 0;
+  _missedSteps = 0;
+}
+
+void LatencyProbe::markStep(uint32_t sampleMs) {
+  if (_stepPending) {
+    _missedSteps++;
+  }
+  _stepPending = true;
+  _stepMs = sampleMs;
+  _stepFrom = _lastFrameValue;
+  _steps++;
+}
+
+uint32_t LatencyProbe::beginFrame(uint32_t sampleMs, float breathValue) {
+  uint32_t tag = _nextTag++;
+  Frame& frame = _frames[tag % MAX_FRAMES_IN_FLIGHT];
+  frame.tag = tag;
+  frame.sampleMs = sampleMs;
+  frame.hasStep = false;
+
+  // First frame that visibly answers the pending step
+  if (_stepPending && fabsf(breathValue - _stepFrom) >= LATENCY_STEP_RESPONSE) {
+    frame.hasStep = true;
+    frame.stepMs = _stepMs;
+    _stepPending = false;
+  }
+
+  _lastFrameValue = breathValue;
+  return tag;
+}
+
+void LatencyProbe::frameShown(uint32_t tag, uint32_t shownMs) {
+  const Frame& frame = _frames[tag % MAX_FRAMES_IN_FLIGHT];
+  if (frame.tag != tag) {
+    return;  // Overwritten by later frames before it was reported
+  }
+
+  _age.add((shownMs - frame.sampleMs) * 1000u);
+  if (frame.hasStep) {
+    _step.add((shownMs - frame.stepMs) * 1000u);
+  }
+}
+
+void LatencyProbe::print() const {
+  // avg/p50/p95/max in milliseconds
+  char line[160];
+  snprintf(line, sizeof(line), "LAT ms age %.1f/%.1f/%.1f/%.1f step %.1f/%.1f/%.1f/%.1f n %lu/%lu missed %lu",
+           _age.getAverage() / 1000.0f, _age.getPercentile(0.5f) / 1000.0f,
+           _age.getPercentile(0.95f) / 1000.0f, _age.getMax() / 1000.0f,
+           _step.getAverage() / 1000.0f, _step.getPercentile(0.5f) / 1000.0f,
+           _step.getPercentile(0.95f) / 1000.0f, _step.getMax() / 1000.0f,
+           (unsigned long)_step.getCount(), (unsigned long)_steps, (unsigned long)_missedSteps);
+  Serial.println(line);
+}
+
+void LatencyProbe::dumpIfDue(unsigned long nowMs) {
+  if (PROFILER_DUMP_INTERVAL_MS == 0 || nowMs - _lastDumpMs < PROFILER_DUMP_INTERVAL_MS) {
+    return;
+  }
+  _lastDumpMs = nowMs;
+  if (_age.getCount() == 0) {
+    return;
+  }
+  print();
+
+  // Start a new window. Frames in flight and a pending step carry over, so
+  // they are still reported in the next one.
+  _age.reset();
+  _step.reset();
+  _steps = _stepPending ? 1 : 0;
+  _missedSteps = 0;
+}
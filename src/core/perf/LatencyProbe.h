@@ -0,0 +1,84 @@
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include "config.h"
+#include "FrameProfiler.h"
+
+// End-to-end input latency (LATENCY_PROBE builds).
+//
+// Each scene frame is tagged with the timestamp of the newest sample
+// BreathData had consumed when the frame's update ran (beginFrame()). The
+// display reports when that frame's pixels finished transferring
+// (frameShown()), and the difference goes into the "age" histogram: sensor
+// read to photons, excluding how long the signal takes to build up.
+//
+// Latencies are kept in the microsecond histograms at millisecond resolution.
+//
+// For step response, markStep() notes the timestamp of the first sample
+// after a step in the input (the simulator's scripted SPIRO_STEP input).
+// The first frame whose input value has since moved by at least
+// LATENCY_STEP_RESPONSE carries the step time as well, so the "step"
+// histogram adds filter, normalization and prediction lag on top.
+class LatencyProbe {
+public:
+  LatencyProbe() { reset(); }
+
+  // Clear histograms and any pending step
+  void reset();
+
+  // The sample read at sampleMs is the first one after an input step
+  void markStep(uint32_t sampleMs);
+
+  // A scene frame starts from the sample read at sampleMs, with the breath
+  // value the scene sees (-1..+1). Returns the tag to pass to the display.
+  uint32_t beginFrame(uint32_t sampleMs, float breathValue);
+
+  // The frame tagged tag was fully pushed to the panel at shownMs
+  // (Clock::millis(), the clock sample timestamps use)
+  void frameShown(uint32_t tag, uint32_t shownMs);
+
+  const PhaseHistogram& getAgeHistogram() const { return _age; }
+  const PhaseHistogram& getStepHistogram() const { return _step; }
+
+  // Steps marked in this window / steps never answered by a frame
+  uint32_t getSteps() const { return _steps; }
+  uint32_t getMissedSteps() const { return _missedSteps; }
+
+  // Print a summary line over serial
+  void print() const;
+
+  // print() every PROFILER_DUMP_INTERVAL_MS, then start a new window
+  void dumpIfDue(unsigned long nowMs);
+
+private:
+  // Frames can still be in flight while the next ones are tagged
+  static const int MAX_FRAMES_IN_FLIGHT = 4;
+
+  struct Frame {
+    uint32_t tag;
+    uint32_t sampleMs;
+    uint32_t stepMs;
+    bool hasStep;
+  };
+
+  Frame _frames[MAX_FRAMES_IN_FLIGHT];
+  uint32_t _nextTag = 0;
+
+  PhaseHistogram _age;
+  PhaseHistogram _step;
+
+  // Step waiting for the input value to respond
+  bool _stepPending = false;
+  uint32_t _stepMs = 0;
+  float _stepFrom = 0;        // Value the last frame before the step saw
+  float _lastFrameValue = 0;
+  uint32_t _steps = 0;
+  uint32_t _missedSteps = 0;
+
+  unsigned long _lastDumpMs = 0;
+};
+
+// Global latency probe instance (defined in main.cpp of LATENCY_PROBE builds)
+extern LatencyProbe latencyProbe;
+
+#endif // LATENCY_PROBE_H
@@ -19,6 +19,10 @@ public:
 
   // Target frames per second for this scene
   virtual int getFps() const { return 30; }
+
+  // How far ahead (ms) of the latest sample to predict the breath input, to
+  // cover the delay until this frame is on screen (0 = no prediction)
+  virtual uint32_t getInputLookaheadMs() const { return 0; }
 };
 
 #endif // SCENE_BASE_H
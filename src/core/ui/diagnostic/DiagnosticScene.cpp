@@ -3,6 +3,7 @@
 #include "core/hardware/BreathData.h"
 #include "core/hardware/Display.h"
 #include "core/hardware/Sensor.h"
+#include "core/perf/FrameProfiler.h"
 
 #ifndef SIMULATOR
   #include <Arduino.h>
@@ -11,7 +12,9 @@
 #endif
 
 DiagnosticScene::DiagnosticScene()
-  : _pressureDelta(0) {
+  : _pressureDelta(0)
+  , _profilerOverlay(false)
+  , _breathStatsOverlay(false) {
 }
 
 void DiagnosticScene::update(float dt) {
@@ -80,6 +83,15 @@ void DiagnosticScene::draw(Canvas& canvas) {
     }
   }
 
+  if (_profilerOverlay) {
+    drawProfilerOverlay(canvas);
+    return;
+  }
+  if (_breathStatsOverlay) {
+    drawBreathStatsOverlay(canvas);
+    return;
+  }
+
   // Absolute pressure in inHg
   canvas.setCursor(10, 68);
   canvas.setTextColor(TFT_WHITE);
@@ -116,3 +128,74 @@ void DiagnosticScene::draw(Canvas& canvas) {
   canvas.print(" Max:");
   canvas.print(breathData.getMaxDelta(), 0);
 }
+
+void DiagnosticScene::drawProfilerOverlay(Canvas& canvas) {
+  int y = 62;
+  canvas.fillRect(0, y, SCREEN_WIDTH, SCREEN_HEIGHT - y, TFT_BLACK);
+
+  // Header: microseconds per phase over the current dump window
+  canvas.setTextSize(1);
+  canvas.setCursor(4, y);
+  canvas.setTextColor(TFT_GRAY);
+  canvas.print("us   avg  p95  max");
+  y += 8;
+
+  for (int i = 0; i < PHASE_COUNT; i++) {
+    const PhaseHistogram& h = frameProfiler.getHistogram((FramePhase)i);
+    canvas.setCursor(4, y);
+    canvas.setTextColor(i == PHASE_FRAME ? TFT_YELLOW : TFT_WHITE);
+    canvas.printf("%s %5lu%5lu%5lu", FrameProfiler::getPhaseName((FramePhase)i),
+                  (unsigned long)h.getAverage(),
+                  (unsigned long)h.getPercentile(0.95f),
+                  (unsigned long)h.getMax());
+    y += 8;
+  }
+
+  // Frames that took longer than their scene's frame interval
+  canvas.setCursor(4, y + 1);
+  canvas.setTextColor(frameProfiler.getOverruns() ? TFT_RED : TFT_GREEN);
+  canvas.printf("over %lu/%lu", (unsigned long)frameProfiler.getOverruns(),
+                (unsigned long)frameProfiler.getFrames());
+}
+
+void DiagnosticScene::drawBreathStatsOverlay(Canvas& canvas) {
+  const BreathAnalytics& stats = breathData.getAnalytics();
+  int y = 62;
+  canvas.fillRect(0, y, SCREEN_WIDTH, SCREEN_HEIGHT - y, TFT_BLACK);
+  canvas.setTextSize(1);
+
+  // Rate over the sliding window
+  canvas.setCursor(4, y);
+  canvas.setTextColor(TFT_YELLOW);
+  canvas.printf("BPM %4.1f  (%d cyc)", stats.getBreathsPerMinute(), stats.getCycleCount());
+  y += 10;
+
+  // Phase durations and I:E ratio
+  canvas.setCursor(4, y);
+  canvas.setTextColor(TFT_WHITE);
+  canvas.printf("In %.1fs  Ex %.1fs", stats.getMeanInhaleMs() / 1000.0f, stats.getMeanExhaleMs() / 1000.0f);
+  y += 10;
+
+  canvas.setCursor(4, y);
+  float ie = stats.getIERatio();
+  if (ie > 0) {
+    canvas.printf("I:E 1:%.2f", 1.0f / ie);
+  } else {
+    canvas.print("I:E --");
+  }
+  y += 10;
+
+  // Breath-to-breath variability
+  canvas.setCursor(4, y);
+  canvas.setTextColor(TFT_ORANGE);
+  canvas.printf("Cycle %.1fs sd %lums", stats.getMeanCycleMs() / 1000.0f,
+                (unsigned long)stats.getCycleStdDevMs());
+  y += 10;
+
+  // Mean peaks per phase
+  canvas.setCursor(4, y);
+  canvas.setTextColor(TFT_MAGENTA);
+  canvas.printf("Pk %.0f", stats.getMeanInhalePeak());
+  canvas.setTextColor(TFT_CYAN);
+  canvas.printf(" +%.0f Pa", stats.getMeanExhalePeak());
+}
@@ -11,8 +11,23 @@ public:
   void draw(Canvas& canvas) override;
   int getFps() const override { return 10; }
 
+  // Replace the pressure/temperature readout with per-phase frame timings
+  void setProfilerOverlay(bool enabled) { _profilerOverlay = enabled; }
+  void toggleProfilerOverlay() { _profilerOverlay = !_profilerOverlay; }
+  bool isProfilerOverlayEnabled() const { return _profilerOverlay; }
+
+  // Replace the pressure/temperature readout with breath analytics
+  void setBreathStatsOverlay(bool enabled) { _breathStatsOverlay = enabled; }
+  void toggleBreathStatsOverlay() { _breathStatsOverlay = !_breathStatsOverlay; }
+  bool isBreathStatsOverlayEnabled() const { return _breathStatsOverlay; }
+
 private:
+  void drawProfilerOverlay(Canvas& canvas);
+  void drawBreathStatsOverlay(Canvas& canvas);
+
   float _pressureDelta;
+  bool _profilerOverlay;
+  bool _breathStatsOverlay;
 };
 
 #endif // DIAGNOSTIC_SCENE_H
@@ -0,0 +1,63 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include "config.h"
+#include <atomic>
+
+// Source of game time. Game logic reads time through Clock instead of
+// calling millis()/micros() directly, so a test or the simulator can swap
+// in a virtual clock and run the game loop faster than real time.
+class TimeSource {
+public:
+  virtual ~TimeSource() {}
+  virtual uint32_t millis() const = 0;
+  virtual uint32_t micros() const = 0;
+};
+
+// Wall clock (Arduino millis()/micros(), or the simulator's shim)
+class SystemTimeSource : public TimeSource {
+public:
+  uint32_t millis() const override { return ::millis(); }
+  uint32_t micros() const override { return ::micros(); }
+};
+
+// Clock that only moves when stepped. Safe to read from another thread
+// (e.g. the simulator sampling thread) while the main thread steps it.
+class VirtualTimeSource : public TimeSource {
+public:
+  explicit VirtualTimeSource(uint32_t startMs = 0) : _ms(startMs) {}
+
+  uint32_t millis() const override { return _ms.load(); }
+  // Millisecond resolution; wraps like Arduino micros()
+  uint32_t micros() const override { return _ms.load() * 1000u; }
+
+  void advanceMs(uint32_t ms) { _ms += ms; }
+
+private:
+  std::atomic<uint32_t> _ms;
+};
+
+// Active game clock (system time unless replaced)
+class Clock {
+public:
+  static uint32_t millis() { return active()->millis(); }
+  static uint32_t micros() { return active()->micros(); }
+
+  // Replace the clock; nullptr restores system time
+  static void setSource(TimeSource* source) { active() = source ? source : &system(); }
+
+  static bool isSystem() { return active() == &system(); }
+
+private:
+  static SystemTimeSource& system() {
+    static SystemTimeSource source;
+    return source;
+  }
+
+  static TimeSource*& active() {
+    static TimeSource* source = &system();
+    return source;
+  }
+};
+
+#endif // CLOCK_H
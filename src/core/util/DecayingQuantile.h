@@ -0,0 +1,93 @@
+#ifndef DECAYING_QUANTILE_H
+#define DECAYING_QUANTILE_H
+
+#include <math.h>
+#include <stdint.h>
+
+// Streaming quantile estimate over recent values, in constant memory.
+//
+// Values in [minValue, maxValue] are counted in Buckets log-spaced buckets
+// (equal relative resolution, e.g. ~17% for 48 buckets over 1..2000).
+// Older values fade out exponentially: each add() weighs 1/decay times the
+// previous one, so the effective memory is about 1 / (1 - decay) values.
+// Rather than scaling every bucket per add, the add weight grows and the
+// buckets are rescaled only when it gets large, so add() is O(1);
+// quantile() walks the buckets (O(Buckets)).
+template<int Buckets>
+class DecayingQuantile {
+  static_assert(Buckets >= 2, "DecayingQuantile needs at least two buckets");
+
+public:
+  DecayingQuantile(float minValue, float maxValue, float decay)
+    : _logMin(logf(minValue))
+    , _bucketsPerLog((Buckets - 1) / (logf(maxValue) - logf(minValue)))
+    , _growth(1.0f / decay) {
+    reset();
+  }
+
+  void reset() {
+    for (int i = 0; i < Buckets; i++) {
+      _weights[i] = 0;
+    }
+    _total = 0;
+    _addWeight = 1.0f;
+    _count = 0;
+  }
+
+  // Add a value (clamped to the bucket range)
+  void add(float value) {
+    int bucket = value > 0 ? (int)((logf(value) - _logMin) * _bucketsPerLog + 0.5f) : 0;
+    if (bucket < 0) bucket = 0;
+    if (bucket >= Buckets) bucket = Buckets - 1;
+
+    _weights[bucket] += _addWeight;
+    _total += _addWeight;
+    _addWeight *= _growth;
+    _count++;
+
+    // Rescale before the weights lose float precision
+    if (_addWeight > RESCALE_WEIGHT) {
+      float scale = 1.0f / _addWeight;
+      for (int i = 0; i < Buckets; i++) {
+        _weights[i] *= scale;
+      }
+      _total *= scale;
+      _addWeight = 1.0f;
+    }
+  }
+
+  // Value below which fraction q (0..1) of the recent weight lies
+  // (0 if nothing was added)
+  float quantile(float q) const {
+    if (_total <= 0) return 0;
+
+    float target = q * _total;
+    float sum = 0;
+    for (int i = 0; i < Buckets; i++) {
+      sum += _weights[i];
+      if (sum >= target) {
+        return bucketValue(i);
+      }
+    }
+    return bucketValue(Buckets - 1);
+  }
+
+  // Values added since reset()
+  uint32_t getCount() const { return _count; }
+
+private:
+  static constexpr float RESCALE_WEIGHT = 1e6f;
+
+  // Bucket center value
+  float bucketValue(int bucket) const { return expf(_logMin + bucket / _bucketsPerLog); }
+
+  float _weights[Buckets];
+  float _total;
+  float _addWeight;
+  float _logMin;
+  float _bucketsPerLog;
+  float _growth;
+  uint32_t _count;
+};
+
+#endif // DECAYING_QUANTILE_H
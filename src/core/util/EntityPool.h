@@ -0,0 +1,70 @@
+#ifndef ENTITY_POOL_H
+#define ENTITY_POOL_H
+
+#include <stdint.h>
+
+// Fixed-capacity pool of entity ids for structure-of-arrays storage.
+// Owners keep one array per component (x[Capacity], y[Capacity], ...)
+// indexed by id; the pool only tracks which ids are live.
+//
+// Ids live in one permutation array: [0, count) is the dense active list,
+// [count, Capacity) is the free list. spawn() and remove() are O(1)
+// (remove swaps the last active id into the hole), so iterating touches
+// only live entities:
+//
+//   for (uint16_t i = 0; i < pool.count();) {
+//     uint16_t id = pool[i];
+//     if (dead) pool.remove(id); else i++;  // removal moves a new id to i
+//   }
+template<uint16_t Capacity>
+class EntityPool {
+  static_assert(Capacity > 0 && Capacity < 0xFFFF, "EntityPool capacity out of range");
+
+public:
+  static const uint16_t INVALID = 0xFFFF;
+
+  EntityPool() { clear(); }
+
+  // Free every id
+  void clear() {
+    for (uint16_t i = 0; i < Capacity; i++) {
+      _ids[i] = i;
+      _slot[i] = i;
+    }
+    _count = 0;
+  }
+
+  // Take a free id, or INVALID when full
+  uint16_t spawn() {
+    if (_count >= Capacity) {
+      return INVALID;
+    }
+    return _ids[_count++];
+  }
+
+  // Release a live id; the last active id moves into its slot
+  void remove(uint16_t id) {
+    uint16_t slot = _slot[id];
+    uint16_t last = _ids[--_count];
+    _ids[slot] = last;
+    _slot[last] = slot;
+    _ids[_count] = id;
+    _slot[id] = _count;
+  }
+
+  bool isActive(uint16_t id) const { return _slot[id] < _count; }
+
+  uint16_t count() const { return _count; }
+  bool isFull() const { return _count >= Capacity; }
+  static uint16_t capacity() { return Capacity; }
+
+  // Id of the i-th live entity (0 <= i < count())
+  uint16_t operator[](uint16_t i) const { return _ids[i]; }
+
+private:
+  uint16_t _ids[Capacity];   // Active ids, then free ids
+  uint16_t _slot[Capacity];  // Position of each id in _ids
+  uint16_t _count;
+};
+
+#endif // ENTITY_POOL_H
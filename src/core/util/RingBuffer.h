@@ -0,0 +1,64 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Fixed-size lock-free ring buffer for one producer and one consumer.
+// The producer (e.g. a sampling task) calls push() while the consumer
+// (e.g. the main loop) calls pop() concurrently, without locks.
+// Capacity must be a power of two.
+template<typename T, uint32_t Capacity>
+class RingBuffer {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "RingBuffer capacity must be a power of two");
+
+public:
+  // Producer: append an item. Returns false (and counts a drop) when full.
+  bool push(const T& item) {
+    uint32_t head = _head.load(std::memory_order_relaxed);
+    if (head - _tail.load(std::memory_order_acquire) >= Capacity) {
+      _dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    _items[head & (Capacity - 1)] = item;
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: remove the oldest item. Returns false when empty.
+  bool pop(T& item) {
+    uint32_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail == _head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    item = _items[tail & (Capacity - 1)];
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: discard everything queued so far
+  void clear() {
+    _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+  }
+
+  // Number of queued items (approximate while the producer is running)
+  uint32_t size() const {
+    return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+  }
+
+  bool empty() const { return size() == 0; }
+
+  // Items rejected because the buffer was full
+  uint32_t getDropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+  static uint32_t capacity() { return Capacity; }
+
+private:
+  T _items[Capacity];
+  std::atomic<uint32_t> _head{0};
+  std::atomic<uint32_t> _tail{0};
+  std::atomic<uint32_t> _dropped{0};
+};
+
+#endif // RING_BUFFER_H
@@ -6,9 +6,14 @@
 
 #include "config.h"
 #include "core/hardware/BreathData.h"
+#include "core/hardware/BreathRecorder.h"
 #include "core/hardware/Display.h"
 #include "core/hardware/Sensor.h"
 #include "core/hardware/Storage.h"
+#include "core/perf/FrameProfiler.h"
+#include "core/perf/LatencyProbe.h"
+#include "core/util/Clock.h"
+#include "core/ui/diagnostic/DiagnosticScene.h"
 #include "scenes/BalloonScene.h"
 
 // ========================================
@@ -19,14 +24,30 @@ SerialMock Serial;
 #endif
 
 BreathData breathData;
+BreathRecorder breathRecorder;
 Display display;
 Sensor pressureSensor;
 Storage storage;
+FrameProfiler frameProfiler;
+#if LATENCY_PROBE
+LatencyProbe latencyProbe;
+#endif
 BalloonScene* balloonScene = nullptr;
+DiagnosticScene* diagnosticScene = nullptr;
+SceneBase* activeScene = nullptr;  // Scene being updated and drawn
 
 // Scene frame timing
 unsigned long lastSceneUpdate = 0;
 
+// ========================================
+// Scene Switching
+// ========================================
+void switchScene(SceneBase* scene) {
+  activeScene = scene;
+  activeScene->init();
+  lastSceneUpdate = Clock::millis();
+}
+
 // ========================================
 // Setup
 // ========================================
@@ -38,6 +59,7 @@ void setup() {
   Serial.println("====================");
   Serial.println("Controls:");
   Serial.println("  Mouse Y: Breath pressure (up=exhale, down=inhale)");
+  Serial.println("  D: Diagnostics (P: frame timings, B: breath stats)");
   Serial.println("  ESC/Q: Quit");
   Serial.println("");
 #else
@@ -55,13 +77,16 @@ void setup() {
   // Load calibration from storage
   storage.loadCalibration(breathData.inhaleThreshold, breathData.exhaleThreshold);
 
-  // Calibrate baseline
-  pressureSensor.calibrateBaseline();
+  // Start sampling right away: the baseline calibrates online
+  pressureSensor.startSampling();
+  breathRecorder.begin();
 
   // Create balloon scene
   balloonScene = new BalloonScene();
-  balloonScene->init();
-  lastSceneUpdate = millis();
+  diagnosticScene = new DiagnosticScene();
+  diagnosticScene->setProfilerOverlay(DIAGNOSTIC_PROFILER_OVERLAY);
+  diagnosticScene->setBreathStatsOverlay(DIAGNOSTIC_BREATH_STATS_OVERLAY);
+  switchScene(DIAGNOSTIC_AT_BOOT ? (SceneBase*)diagnosticScene : balloonScene);
 
   Serial.println("Balloon game ready!");
 }
@@ -70,30 +95,60 @@ void setup() {
 // Main Loop
 // ========================================
 void loop() {
-  // Update sensor readings
-  pressureSensor.update();
-  float pressureDelta = pressureSensor.getDelta();
+  // Detect breath state from every sample queued since the last loop
+  frameProfiler.beginPhase(PHASE_SENSOR);
+  while (pressureSensor.poll()) {
+    breathRecorder.record(pressureSensor.getSample());
 
-  // Detect breath state
-  breathData.detect(pressureDelta);
+    frameProfiler.beginPhase(PHASE_DETECT);
+    breathData.detect(pressureSensor.getDelta(), pressureSensor.getSampleTime());
+    pressureSensor.trackBaseline(breathData.isQuiescent());
+    frameProfiler.beginPhase(PHASE_SENSOR);
+  }
+  frameProfiler.endPhase();
 
   // Update and draw scene at target FPS
-  if (balloonScene) {
-    unsigned long now = millis();
-    unsigned long frameInterval = 1000 / balloonScene->getFps();
+  if (activeScene) {
+    unsigned long now = Clock::millis();
+    unsigned long frameInterval = 1000 / activeScene->getFps();
 
     if (now - lastSceneUpdate >= frameInterval) {
       float dt = (now - lastSceneUpdate) / 1000.0f;
       lastSceneUpdate = now;
 
-      balloonScene->update(dt);
+#if LATENCY_PROBE
+      // Tag the frame with the newest input sample and the value it shows
+      display.tagFrame(latencyProbe.beginFrame(
+          breathData.getLastSampleTime(),
+          breathData.getPredictedNormalizedBreathRaw(activeScene->getInputLookaheadMs())));
+#endif
 
+      frameProfiler.beginPhase(PHASE_UPDATE);
+      activeScene->update(dt);
+
+      frameProfiler.beginPhase(PHASE_DRAW);
       Canvas& canvas = display.getCanvas();
-      balloonScene->draw(canvas);
+      activeScene->draw(canvas);
+
+      frameProfiler.beginPhase(PHASE_BLIT);
       display.blit();
+
+      frameProfiler.endFrame(activeScene->getFps());
+      frameProfiler.dumpIfDue(now);
+
+#if LATENCY_PROBE
+      uint32_t shownTag, shownMs;
+      while (display.pollShownFrame(shownTag, shownMs)) {
+        latencyProbe.frameShown(shownTag, shownMs);
+      }
+      latencyProbe.dumpIfDue(now);
+#endif
     }
   }
 
+  // Write the session recording out after the frame, not in the sample drain
+  breathRecorder.service(Clock::millis());
+
 #ifndef SIMULATOR
   delay(MAIN_LOOP_DELAY_MS);
 #endif
@@ -104,6 +159,10 @@ void loop() {
 // ========================================
 #ifdef SIMULATOR
 #include <lgfx/v1/platforms/sdl/Panel_sdl.hpp>
+#include <stdlib.h>
+
+// Virtual-time loop() steps between window refreshes (SPIRO_FAST)
+static const int SIM_FAST_LOOPS_PER_REFRESH = 500;
 
 static bool handleEvents() {
   SDL_Event event;
@@ -117,6 +176,17 @@ static bool handleEvents() {
           case SDLK_ESCAPE:
           case SDLK_q:
             return false;
+
+          // Diagnostics: D switches scenes, P/B toggle its overlays
+          case SDLK_d:
+            switchScene(activeScene == diagnosticScene ? (SceneBase*)balloonScene : diagnosticScene);
+            break;
+          case SDLK_p:
+            diagnosticScene->toggleProfilerOverlay();
+            break;
+          case SDLK_b:
+            diagnosticScene->toggleBreathStatsOverlay();
+            break;
         }
         break;
 
@@ -135,8 +205,22 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
+  // SPIRO_FAST with SPIRO_REPLAY: run the game on a virtual clock, many
+  // loop() steps per window refresh, until the recording ends
+  static VirtualTimeSource virtualClock;
+  bool fast = getenv("SPIRO_FAST") && getenv("SPIRO_REPLAY");
+  if (fast) {
+    Clock::setSource(&virtualClock);
+  }
+
   setup();
 
+  if (fast && !pressureSensor.isReplaying()) {
+    Serial.println("SPIRO_FAST needs a valid SPIRO_REPLAY recording");
+    fast = false;
+    Clock::setSource(nullptr);
+  }
+
   uint32_t lastLoopTime = 0;
 
   // Main loop - Panel_sdl::loop() returns non-zero when window is closed
@@ -145,14 +229,34 @@ int main(int argc, char* argv[]) {
       break;
     }
 
+    if (fast) {
+      for (int i = 0; i < SIM_FAST_LOOPS_PER_REFRESH && !pressureSensor.isReplayFinished(); i++) {
+        virtualClock.advanceMs(MAIN_LOOP_DELAY_MS);
+        loop();
+      }
+      if (pressureSensor.isReplayFinished()) {
+        break;
+      }
+      continue;
+    }
+
     // Run main loop at ~50Hz
     uint32_t now = millis();
     if (now - lastLoopTime >= MAIN_LOOP_DELAY_MS) {
       lastLoopTime = now;
       loop();
     }
+
+    // SPIRO_STEP: stop once the scripted input is done
+    if (pressureSensor.isStepFinished()) {
+      break;
+    }
   }
 
+#if LATENCY_PROBE
+  latencyProbe.print();
+#endif
+  breathRecorder.end();
   lgfx::Panel_sdl::close();
   return 0;
 }
@@ -3,59 +3,62 @@
 
 #include "core/scenes/SceneBase.h"
 #include "config.h"
+#include "core/gfx/Parallax.h"
+#include "core/gfx/ParticleSystem.h"
+#include "core/hardware/BreathFilter.h"
+#include "core/util/EntityPool.h"
 
 class BalloonScene : public SceneBase {
 public:
   BalloonScene();
-  ~BalloonScene();
 
   void init() override;
   void update(float dt) override;
   void draw(Canvas& canvas) override;
   int getFps() const override { return 50; }
+  // About one frame of update/draw/blit plus the ease below
+  uint32_t getInputLookaheadMs() const override { return 40; }
 
 private:
-  struct Collectible {
-    float x;
-    float y;
-    bool active;
-    bool collecting;
-    float fadeTimer;
-  };
-
-  void generateBackgroundTile();
-  void drawBalloon(Canvas& canvas, int x, int y, uint16_t color, float squash, int8_t squashDir, float stringVelocity);
+  void drawBalloon(Canvas& canvas, int x, int y, float squash, int8_t squashDir, float stringVelocity);
   void drawBalloonString(Canvas& canvas, int x, int y, float stringVelocity, uint16_t stringColor);
   void drawCollectible(Canvas& canvas, float x, float y, float alpha);
-  void spawnCollectible(int index);
+  void spawnCollectible();
   void checkCollectibleCollision(int balloonX, int balloonY);
 
-  // Background
-  LGFX_Sprite* _bgTile;
-  float _scrollX;
+  // Background scroll (baked layers, see assets/BalloonAssets.h)
+  ParallaxBackground _background;
 
-  // Collectible sprites (keyframes for fade animation)
-  static const int COLLECTIBLE_KEYFRAMES = 5;
-  LGFX_Sprite* _collectibleSprites[COLLECTIBLE_KEYFRAMES];
-  void createCollectibleSprites();
-
-  // Balloon state
+  // Balloon state (eased toward the normalized breath at half the gap per frame)
+  IirLowPass<1, 2> _balloonEase;
   float _smoothedNormalized;
   float _deltaNormalizedY;
 
+  // Balloon frame palette (swap565, index 0 transparent) and string color
+  uint16_t _balloonPalette[4];
+  uint16_t _stringColor;
+
   // String physics simulation
   float _stringEndY;        // Simulated string end Y position
   float _stringEndVelocity; // String end Y velocity
 
-  // Collectibles
-  static const int MAX_COLLECTIBLES = 32;
-  Collectible _collectibles[MAX_COLLECTIBLES];
+  // Collectibles (structure of arrays indexed by pool id)
+  static const uint16_t MAX_COLLECTIBLES = 32;
+  typedef EntityPool<MAX_COLLECTIBLES> CollectiblePool;
+  CollectiblePool _collectibles;
+  float _collectibleX[MAX_COLLECTIBLES];
+  float _collectibleY[MAX_COLLECTIBLES];
+  float _collectibleFade[MAX_COLLECTIBLES];  // Seconds since pickup, or COLLECTIBLE_NOT_COLLECTING
   float _timeLeftToSpawn;
-  int _activeCollectibleCount;
   float _elapsedTime;
 
   // Score
   unsigned long _score;
+
+  // Pickup and breath effects
+  static const uint16_t MAX_PARTICLES = 128;
+  ParticleSystem<MAX_PARTICLES> _particles;
+  bool _exhaling;  // Between exhale start and end events
 };
 
 #endif // BALLOON_SCENE_H
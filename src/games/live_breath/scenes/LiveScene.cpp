@@ -2,6 +2,7 @@
 #include "config.h"
 #include "core/hardware/BreathData.h"
 #include "core/hardware/Display.h"
+#include <cmath>
 
 #ifndef SIMULATOR
   #include <Arduino.h>
@@ -9,53 +10,134 @@
   #include "Platform.h"
 #endif
 
+// ========================================
+// Configuration Constants
+// ========================================
+
+// Binary angle units per radian (2^32 = one turn)
+static const float ANGLE_PER_RADIAN = 4294967296.0f / TWO_PI;
+
+// Wave layers: spatial frequency, scroll speed, amplitude
+struct WaveLayer {
+  float frequency;  // radians per pixel
+  float speed;      // radians per second
+  int amplitude;    // pixels
+};
+
+static const WaveLayer WAVE_LAYERS_CONFIG[] = {
+  { 0.15f,  2.5f,  8 },
+  { 0.08f,  3.25f, 5 },
+  { 0.22f, -1.75f, 3 }
+};
+
+static const float MAX_DISPLACEMENT = 50.0f;
+
+static const float COUNT_FLASH_TIME = 0.5f;  // Seconds the breath counter stays highlighted
+
+int16_t LiveScene::_sineTable[LiveScene::SINE_TABLE_SIZE];
+
+void LiveScene::buildSineTable() {
+  static bool built = false;
+  if (built) return;
+  built = true;
+
+  for (int i = 0; i < SINE_TABLE_SIZE; i++) {
+    _sineTable[i] = (int16_t)lroundf(sinf(i * TWO_PI / SINE_TABLE_SIZE) * 16384.0f);
+  }
+}
+
 LiveScene::LiveScene()
-  : _wavePhase(0)
-  , _targetWaveHeight(SCREEN_HEIGHT / 2)
-  , _currentWaveHeight(SCREEN_HEIGHT / 2) {
+  : _currentWaveHeight(SCREEN_HEIGHT / 2)
+  , _countFlash(0) {
+  buildSineTable();
+
+  for (int i = 0; i < WAVE_LAYERS; i++) {
+    _layerPhase[i] = 0;
+  }
+
+  // Sky gradient never changes: one color per row
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    uint8_t brightness = map(y, 0, SCREEN_HEIGHT, 60, 20);
+    _skyRows[y] = Display::rgb565(brightness, brightness, brightness + 30);
+  }
+
+  _waterColor = Display::rgb565(0, 120, 180);
+  _foamColor = Display::rgb565(120, 180, 255);
+}
+
+void LiveScene::init() {
+  // Only count breaths completed from now on
+  breathData.clearEvents();
+  _countFlash = 0;
 }
 
 void LiveScene::update(float dt) {
-  // Animate wave phase (horizontal scroll)
-  _wavePhase += 2.5f * dt;
-  if (_wavePhase > TWO_PI) _wavePhase -= TWO_PI;
+  // Animate wave phases (horizontal scroll); 64-bit step so a long dt wraps cleanly
+  for (int i = 0; i < WAVE_LAYERS; i++) {
+    _layerPhase[i] += (uint32_t)(int64_t)(WAVE_LAYERS_CONFIG[i].speed * dt * ANGLE_PER_RADIAN);
+  }
 
-  // Calculate target wave height based on normalized breath (-1 to +1)
-  float normalized = breathData.getNormalizedBreath();
-  float maxDisplacement = 50.0f;
-  _targetWaveHeight = (SCREEN_HEIGHT / 2) - (normalized * maxDisplacement);
+  // Ease the normalized breath (-1 to +1) for organic movement, then map to height
+  // (no look-ahead: the slow ease is the look of this scene)
+  float target = breathData.getPredictedNormalizedBreathRaw(getInputLookaheadMs());
+  float normalized = _waveEase.process(constrain(target, -1.0f, 1.0f));
+  _currentWaveHeight = (SCREEN_HEIGHT / 2) - (normalized * MAX_DISPLACEMENT);
 
-  // Smooth interpolation for organic movement
-  _currentWaveHeight += (_targetWaveHeight - _currentWaveHeight) * 0.1f;
+  // Highlight the counter when a breath completes (even between frames)
+  if (_countFlash > 0) {
+    _countFlash -= dt;
+  }
+  BreathEvent event;
+  while (breathData.pollEvent(event)) {
+    if (event.type == BREATH_EVENT_CYCLE_COMPLETE) {
+      _countFlash = COUNT_FLASH_TIME;
+    }
+  }
 }
 
 void LiveScene::draw(Canvas& canvas) {
-  // Fixed wave colors
-  uint16_t waterColor = Display::rgb565(0, 120, 180);
-  uint16_t foamColor = Display::rgb565(120, 180, 255);
-
-  // Draw sky gradient
-  for (int y = 0; y < SCREEN_HEIGHT; y++) {
-    uint8_t brightness = map(y, 0, SCREEN_HEIGHT, 60, 20);
-    uint16_t skyColor = Display::rgb565(brightness, brightness, brightness + 30);
-    canvas.drawFastHLine(0, y, SCREEN_WIDTH, skyColor);
+  // Per-column angle step for each layer
+  uint32_t phase[WAVE_LAYERS];
+  uint32_t columnStep[WAVE_LAYERS];
+  for (int i = 0; i < WAVE_LAYERS; i++) {
+    phase[i] = _layerPhase[i];
+    columnStep[i] = (uint32_t)(WAVE_LAYERS_CONFIG[i].frequency * ANGLE_PER_RADIAN);
   }
 
-  // Draw multi-layer wave for depth
+  // Wave surface in Q8 pixels: table lookups and integer adds only
+  int32_t heightQ8 = (int32_t)(_currentWaveHeight * 256.0f);
+  int16_t waveY[SCREEN_WIDTH];
+  int16_t foamHeight[SCREEN_WIDTH];
+  int skyBottom = 0;
+
   for (int x = 0; x < SCREEN_WIDTH; x++) {
-    float wave1 = sin(x * 0.15f + _wavePhase) * 8;
-    float wave2 = sin(x * 0.08f + _wavePhase * 1.3f) * 5;
-    float wave3 = sin(x * 0.22f - _wavePhase * 0.7f) * 3;
+    int32_t sum = heightQ8;
+    int32_t crest = 0;
+    for (int i = 0; i < WAVE_LAYERS; i++) {
+      // Q14 sine * pixels >> 6 = Q8 pixels
+      int32_t layer = (_sineTable[phase[i] >> (32 - SINE_TABLE_BITS)] * WAVE_LAYERS_CONFIG[i].amplitude) >> 6;
+      if (i == 0) crest = layer;
+      sum += layer;
+      phase[i] += columnStep[i];
+    }
 
-    int waveY = (int)(_currentWaveHeight + wave1 + wave2 + wave3);
-    waveY = constrain(waveY, 10, SCREEN_HEIGHT - 10);
+    int y = constrain((int)(sum >> 8), 10, SCREEN_HEIGHT - 10);
+    int foam = (abs(crest) >> 8) / 2 + 2;
+    waveY[x] = y;
+    foamHeight[x] = foam;
+    if (y - foam > skyBottom) skyBottom = y - foam;
+  }
 
-    // Draw foam/crest
-    int foamHeight = abs((int)wave1) / 2 + 2;
-    canvas.drawFastVLine(x, waveY - foamHeight, foamHeight, foamColor);
+  // Sky gradient, only down to the lowest crest (water covers the rest)
+  for (int y = 0; y < skyBottom; y++) {
+    canvas.drawFastHLine(0, y, SCREEN_WIDTH, _skyRows[y]);
+  }
 
-    // Draw water body below wave
-    canvas.drawFastVLine(x, waveY, SCREEN_HEIGHT - waveY, waterColor);
+  // Foam/crest and water body per column
+  for (int x = 0; x < SCREEN_WIDTH; x++) {
+    int y = waveY[x];
+    canvas.drawFastVLine(x, y - foamHeight[x], foamHeight[x], _foamColor);
+    canvas.drawFastVLine(x, y, SCREEN_HEIGHT - y, _waterColor);
   }
 
   // Draw HUD
@@ -67,7 +149,9 @@ void LiveScene::draw(Canvas& canvas) {
   // Breath count
   canvas.setCursor(4, SCREEN_HEIGHT - 10);
   canvas.print("Breaths: ");
+  canvas.setTextColor(_countFlash > 0 ? TFT_YELLOW : TFT_WHITE);
   canvas.print(breathData.getBreathCount());
+  canvas.setTextColor(TFT_WHITE);
 
   // Breath state indicator (top right)
   const char* stateText;
@@ -2,19 +2,41 @@
 #define LIVE_SCENE_H
 
 #include "core/scenes/SceneBase.h"
+#include "config.h"
+#include "core/hardware/BreathFilter.h"
 
 class LiveScene : public SceneBase {
 public:
   LiveScene();
 
+  void init() override;
   void update(float dt) override;
   void draw(Canvas& canvas) override;
   int getFps() const override { return 30; }
 
 private:
-  float _wavePhase;
-  float _targetWaveHeight;
+  // Wave layers summed per column for depth
+  static const int WAVE_LAYERS = 3;
+
+  // Sine lookup: one full turn in SINE_TABLE_SIZE steps, Q14 amplitude
+  static const int SINE_TABLE_BITS = 8;
+  static const int SINE_TABLE_SIZE = 1 << SINE_TABLE_BITS;
+  static int16_t _sineTable[SINE_TABLE_SIZE];
+  static void buildSineTable();
+
+  // Layer phases as binary angles (2^32 = one turn), wrap for free
+  uint32_t _layerPhase[WAVE_LAYERS];
+  // Wave height eased toward the breath a tenth of the gap per frame
+  IirLowPass<1, 10> _waveEase;
   float _currentWaveHeight;
+
+  // Breath counter highlight after each completed breath (seconds left)
+  float _countFlash;
+
+  // Static colors, computed once
+  uint16_t _skyRows[SCREEN_HEIGHT];
+  uint16_t _waterColor;
+  uint16_t _foamColor;
 };
 
 #endif // LIVE_SCENE_H
@@ -0,0 +1,529 @@
+"""Bake procedural sprites into const RGB565 arrays at build time.
+
+Runs as a PlatformIO pre-script (extra_scripts = pre:tools/bake_assets.py)
+or standalone (python tools/bake_assets.py). Each game's assets are drawn
+here with the same primitives the scenes used at runtime, then written as
+a generated header of const arrays in canvas byte order (byte-swapped
+RGB565), so scenes can pushImage() them straight from flash. Multi-color
+shapes whose colors are set in C++ are baked as 2-bit palette sprites
+(core/gfx/IndexedSprite.h).
+
+Generated headers are only rewritten when their content changes.
+"""
+
+import os
+import sys
+
+# ========================================
+# Raster Helpers
+# ========================================
+
+
+def rgb565(rgb):
+    r, g, b = (rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+def swap565(color):
+    return ((color >> 8) | (color << 8)) & 0xFFFF
+
+
+class Raster:
+    """RGB565 image with the LovyanGFX fill primitives the scenes use."""
+
+    def __init__(self, width, height, fill=0):
+        self.width = width
+        self.height = height
+        self.pixels = [fill] * (width * height)
+
+    def hline(self, x, y, w, color):
+        if y < 0 or y >= self.height:
+            return
+        x0, x1 = max(x, 0), min(x + w, self.width)
+        row = y * self.width
+        for px in range(x0, x1):
+            self.pixels[row + px] = color
+
+    def fill_ellipse(self, x0, y0, rx, ry, color):
+        if ry == 0:
+            self.hline(x0 - rx, y0, rx * 2 + 1, color)
+            return
+        if rx == 0:
+            for y in range(y0 - ry, y0 + ry + 1):
+                self.hline(x0, y, 1, color)
+            return
+        rx2, ry2 = rx * rx, ry * ry
+        fx2, fy2 = 4 * rx2, 4 * ry2
+
+        x, y = 0, ry
+        s = 2 * ry2 + rx2 * (1 - 2 * ry)
+        while ry2 * x <= rx2 * y:
+            self.hline(x0 - x, y0 - y, x * 2 + 1, color)
+            self.hline(x0 - x, y0 + y, x * 2 + 1, color)
+            if s >= 0:
+                s += fx2 * (1 - y)
+                y -= 1
+            s += ry2 * (4 * x + 6)
+            x += 1
+
+        x, y = rx, 0
+        s = 2 * rx2 + ry2 * (1 - 2 * rx)
+        while rx2 * y <= ry2 * x:
+            self.hline(x0 - x, y0 - y, x * 2 + 1, color)
+            self.hline(x0 - x, y0 + y, x * 2 + 1, color)
+            if s >= 0:
+                s += fy2 * (1 - x)
+                x -= 1
+            s += rx2 * (4 * y + 6)
+            y += 1
+
+    def fill_triangle(self, x0, y0, x1, y1, x2, y2, color):
+        # Sort by y (y0 <= y1 <= y2)
+        if y0 > y1:
+            x0, y0, x1, y1 = x1, y1, x0, y0
+        if y1 > y2:
+            x1, y1, x2, y2 = x2, y2, x1, y1
+        if y0 > y1:
+            x0, y0, x1, y1 = x1, y1, x0, y0
+
+        if y0 == y2:
+            a, b = min(x0, x1, x2), max(x0, x1, x2)
+            self.hline(a, y0, b - a + 1, color)
+            return
+
+        def div(n, d):
+            return int(n / d)  # C truncation toward zero
+
+        dx01, dy01 = x1 - x0, y1 - y0
+        dx02, dy02 = x2 - x0, y2 - y0
+        dx12, dy12 = x2 - x1, y2 - y1
+        sa = sb = 0
+
+        # Upper part (include y1 only when the bottom edge is flat)
+        last = y1 if y1 == y2 else y1 - 1
+        y = y0
+        while y <= last:
+            a = x0 + div(sa, dy01)
+            b = x0 + div(sb, dy02)
+            sa += dx01
+            sb += dx02
+            if a > b:
+                a, b = b, a
+            self.hline(a, y, b - a + 1, color)
+            y += 1
+
+        # Lower part
+        sa = dx12 * (y - y1)
+        sb = dx02 * (y - y0)
+        while y <= y2:
+            a = x1 + div(sa, dy12)
+            b = x0 + div(sb, dy02)
+            sa += dx12
+            sb += dx02
+            if a > b:
+                a, b = b, a
+            self.hline(a, y, b - a + 1, color)
+            y += 1
+
+    def crop(self):
+        """Bounding box (x, y, w, h) of non-zero pixels."""
+        xs = [i % self.width for i, p in enumerate(self.pixels) if p]
+        ys = [i // self.width for i, p in enumerate(self.pixels) if p]
+        x0, y0 = min(xs), min(ys)
+        return x0, y0, max(xs) - x0 + 1, max(ys) - y0 + 1
+
+    def pack_2bpp(self, x, y, w, h):
+        """Palette indices 0..3, 4 pixels per byte (high bits first), rows byte-aligned."""
+        out = []
+        for row in range(y, y + h):
+            for col in range(x, x + w, 4):
+                byte = 0
+                for i in range(4):
+                    index = self.pixels[row * self.width + col + i] if col + i < x + w else 0
+                    byte |= (index & 3) << (6 - 2 * i)
+                out.append(byte)
+        return out
+
+    def fill_circle(self, x0, y0, r, color):
+        self.hline(x0 - r, y0, r * 2 + 1, color)
+        f = 1 - r
+        ddf_x, ddf_y = 1, -2 * r
+        i, j = 0, -1
+        while True:
+            while f < 0:
+                i += 1
+                ddf_x += 2
+                f += ddf_x
+            ddf_y += 2
+            f += ddf_y
+            self.hline(x0 - i, y0 + r, i * 2 + 1, color)
+            self.hline(x0 - i, y0 - r, i * 2 + 1, color)
+            if i != j:
+                self.hline(x0 - r, y0 + i, r * 2 + 1, color)
+                self.hline(x0 - r, y0 - i, r * 2 + 1, color)
+                j = i
+            r -= 1
+            if i >= r:
+                break
+
+
+# ========================================
+# Balloon Game Assets
+# ========================================
+
+SCREEN_HEIGHT = 128
+
+# Parallax layers, back to front (speeds live in BalloonScene.cpp)
+SKY_TILE_WIDTH = 32
+SKY_TILE_HEIGHT = SCREEN_HEIGHT
+FAR_CLOUDS_WIDTH = 128
+NEAR_CLOUDS_WIDTH = 64
+
+SUNSET_BANDS = [
+    0x962730,
+    0xCC2E2B,
+    0xF45327,
+    0xFA7E38,
+    0xFA9C78,
+    0xFA6859,
+    0xFB9E75,
+    0xFAD28D,
+    0xF8A755,
+]
+CLOUD_COLOR = 0xFA946E
+FAR_CLOUD_COLOR = 0xFAB48A
+
+COLLECTIBLE_RADIUS = 3
+COLLECTIBLE_KEYFRAMES = 3         # Sizes while fading (radius 3, 2, 1)
+COLLECTIBLE_COLOR = 0xFFFFFF
+COLLECTIBLE_OUTER_ALPHA = 0.6     # Soft outer ring
+COLLECTIBLE_MIDDLE_ALPHA = 0.8
+
+
+# Balloon body (keep BALLOON_HEIGHT in sync with BalloonScene.cpp)
+BALLOON_WIDTH = 9
+BALLOON_HEIGHT = 12
+BALLOON_HIGHLIGHT_X_OFFSET = -3
+BALLOON_HIGHLIGHT_Y_OFFSET = -4
+BALLOON_HIGHLIGHT_W = 2
+BALLOON_HIGHLIGHT_H = 3
+BALLOON_KNOT_WIDTH = 4
+BALLOON_KNOT_HEIGHT = 4
+BALLOON_KNOT_OFFSET = -2
+
+# Squash keyframes: squash -0.5 (stretched) .. +0.5 (flattened) in 1/16 steps
+BALLOON_SQUASH_MIN = -0.5
+BALLOON_SQUASH_STEPS = 16
+
+# Palette indices (colors are applied at draw time)
+PAL_OUTLINE = 1
+PAL_BODY = 2
+PAL_HIGHLIGHT = 3
+
+
+def band_color(y):
+    band = min(y // (SKY_TILE_HEIGHT // len(SUNSET_BANDS)), len(SUNSET_BANDS) - 1)
+    return rgb565(SUNSET_BANDS[band])
+
+
+def bake_sky_tile():
+    """Opaque sunset bands (uniform per row, so a narrow tile suffices)."""
+    tile = Raster(SKY_TILE_WIDTH, SKY_TILE_HEIGHT)
+    for y in range(SKY_TILE_HEIGHT):
+        tile.hline(0, y, SKY_TILE_WIDTH, band_color(y))
+    return tile
+
+
+def bake_near_clouds():
+    """Near cloud layer (0 = transparent), scrolls with the collectibles' backdrop."""
+    layer = Raster(NEAR_CLOUDS_WIDTH, SCREEN_HEIGHT)
+    cloud = rgb565(CLOUD_COLOR)
+
+    # Cloud 1: bumps, then a flat bottom by clearing below y=31
+    layer.fill_ellipse(16, 27, 7, 4, cloud)
+    layer.fill_ellipse(10, 29, 5, 3, cloud)
+    layer.fill_ellipse(25, 29, 6, 3, cloud)
+    for y in range(31, 38):
+        layer.hline(0, y, NEAR_CLOUDS_WIDTH, 0)
+
+    # Cloud 2: flat bottom at y=78
+    layer.fill_ellipse(50, 76, 6, 4, cloud)
+    layer.fill_ellipse(42, 78, 5, 3, cloud)
+    layer.fill_ellipse(56, 77, 4, 3, cloud)
+    for y in range(78, 85):
+        layer.hline(0, y, NEAR_CLOUDS_WIDTH, 0)
+
+    return layer
+
+
+def bake_far_clouds():
+    """Far cloud layer: smaller, paler, flat-bottomed wisps."""
+    layer = Raster(FAR_CLOUDS_WIDTH, SCREEN_HEIGHT)
+    cloud = rgb565(FAR_CLOUD_COLOR)
+
+    for cx, cy in ((30, 50), (96, 18), (74, 104)):
+        layer.fill_ellipse(cx, cy, 6, 3, cloud)
+        layer.fill_ellipse(cx - 6, cy + 1, 4, 2, cloud)
+        layer.fill_ellipse(cx + 7, cy + 1, 4, 2, cloud)
+        for y in range(cy + 2, cy + 4):
+            layer.hline(cx - 12, y, 24, 0)
+
+    return layer
+
+
+def span_sprite(raster, alpha=None):
+    """Visible runs per row: (row_start[h + 1], runs[(x, length, offset)], pixels, alphas).
+
+    Without an alpha raster, non-zero pixels are opaque; with one, pixels
+    with non-zero alpha are kept along with their alpha.
+    """
+    mask = alpha if alpha else raster
+    row_start, runs, pixels, alphas = [0], [], [], []
+    for y in range(raster.height):
+        begin = y * raster.width
+        row = mask.pixels[begin:begin + raster.width]
+        x = 0
+        while x < raster.width:
+            if not row[x]:
+                x += 1
+                continue
+            start = x
+            while x < raster.width and row[x] and x - start < 255:
+                x += 1
+            runs.append((start, x - start, len(pixels)))
+            pixels.extend(raster.pixels[begin + start:begin + x])
+            if alpha:
+                alphas.extend(alpha.pixels[begin + start:begin + x])
+        row_start.append(len(runs))
+    return row_start, runs, pixels, alphas
+
+
+def bake_collectible_frames():
+    """Fade keyframes, full size to 50%: (color, alpha) raster pairs.
+
+    Rings get per-pixel alpha (0..32) for a soft edge; the fade itself is a
+    runtime alpha applied on top, so it is correct over any background.
+    """
+    size = (COLLECTIBLE_RADIUS + 2) * 2
+    center = size // 2
+    color = rgb565(COLLECTIBLE_COLOR)
+    frames = []
+    for i in range(COLLECTIBLE_KEYFRAMES):
+        fade = 1.0 - i / (COLLECTIBLE_KEYFRAMES - 1)
+        frame = Raster(size, size)
+        alpha = Raster(size, size)
+
+        radius = int(COLLECTIBLE_RADIUS * (0.5 + 0.5 * fade))
+        rings = (COLLECTIBLE_OUTER_ALPHA, COLLECTIBLE_MIDDLE_ALPHA, 1.0)
+        for ring, ring_alpha in enumerate(rings):
+            if radius > ring:
+                frame.fill_circle(center, center, radius - ring, color)
+                alpha.fill_circle(center, center, radius - ring, int(ring_alpha * 32 + 0.5))
+        frames.append((frame, alpha))
+    return frames
+
+
+def bake_balloon_frame(squash):
+    """Balloon body at one squash value, centered at (0, 0) before cropping.
+
+    Same shapes and order as the former BalloonScene::drawBalloon; the squash
+    values are multiples of 1/16, so the float math matches C++ exactly.
+    """
+    squash_factor = 1.0 - squash * 2.0
+    stretch_factor = 1.0 + squash * 1.6
+    height = int(BALLOON_HEIGHT * squash_factor)
+    width = int(BALLOON_WIDTH * stretch_factor)
+
+    cx, cy = 32, 48
+    img = Raster(64, 96)
+    knot_y = cy + height + BALLOON_KNOT_OFFSET
+
+    # Outlines first, then fills on top
+    img.fill_ellipse(cx, cy, width + 1, height + 1, PAL_OUTLINE)
+    img.fill_triangle(cx - BALLOON_KNOT_WIDTH - 1, knot_y,
+                      cx + BALLOON_KNOT_WIDTH + 1, knot_y,
+                      cx, knot_y + BALLOON_KNOT_HEIGHT + 3, PAL_OUTLINE)
+    img.fill_ellipse(cx, cy, width, height, PAL_BODY)
+
+    highlight_h = int(BALLOON_HIGHLIGHT_H * squash_factor)
+    highlight_w = int(BALLOON_HIGHLIGHT_W * stretch_factor)
+    highlight_y = cy + int(BALLOON_HIGHLIGHT_Y_OFFSET * squash_factor)
+    img.fill_ellipse(cx + BALLOON_HIGHLIGHT_X_OFFSET, highlight_y, highlight_w, highlight_h, PAL_HIGHLIGHT)
+
+    img.fill_triangle(cx - BALLOON_KNOT_WIDTH, knot_y,
+                      cx + BALLOON_KNOT_WIDTH, knot_y,
+                      cx, knot_y + BALLOON_KNOT_HEIGHT + 2, PAL_BODY)
+
+    x, y, w, h = img.crop()
+    return {
+        "origin_x": x - cx,
+        "origin_y": y - cy,
+        "width": w,
+        "height": h,
+        "body_height": height,
+        "string_y": knot_y + BALLOON_KNOT_HEIGHT + 4 - cy,
+        "pixels": img.pack_2bpp(x, y, w, h),
+    }
+
+
+def bake_balloon_frames():
+    return [bake_balloon_frame(BALLOON_SQUASH_MIN + i / BALLOON_SQUASH_STEPS)
+            for i in range(BALLOON_SQUASH_STEPS + 1)]
+
+
+# ========================================
+# Header Output
+# ========================================
+
+
+def format_pixels(pixels, width, indent="  "):
+    """One source line per image row, canvas byte order."""
+    lines = []
+    for row in range(0, len(pixels), width):
+        values = ", ".join("0x%04X" % swap565(p) for p in pixels[row:row + width])
+        lines.append(indent + values + ",")
+    return "\n".join(lines)
+
+
+def format_ints(data, per_line=16, indent="  "):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(str(v) for v in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def format_bytes(data, per_line=16, indent="  "):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def format_span_arrays(name, raster, alpha=None):
+    """Row index, run, pixel (and alpha) arrays of a SpanSprite named name."""
+    row_start, runs, pixels, alphas = span_sprite(raster, alpha)
+    out = []
+    out.append("static const uint16_t %s_ROWS[%d] = {" % (name, len(row_start)))
+    out.append(format_ints(row_start))
+    out.append("};")
+    out.append("static const SpanRun %s_RUNS[%d] = {" % (name, len(runs)))
+    for i in range(0, len(runs), 6):
+        out.append("  " + " ".join("{ %d, %d, %d }," % run for run in runs[i:i + 6]))
+    out.append("};")
+    out.append("static const uint16_t %s_PIXELS[%d] = {" % (name, len(pixels)))
+    out.append(format_pixels(pixels, 16))
+    out.append("};")
+    if alpha:
+        out.append("static const uint8_t %s_ALPHA[%d] = {" % (name, len(alphas)))
+        out.append(format_ints(alphas))
+        out.append("};")
+    return out
+
+
+def span_sprite_init(name, raster, has_alpha=False):
+    return "{ %d, %d, %s_ROWS, %s_RUNS, %s_PIXELS, %s }" % (
+        raster.width, raster.height, name, name, name, name + "_ALPHA" if has_alpha else "nullptr")
+
+
+def format_span_sprite(name, raster):
+    out = format_span_arrays(name, raster)
+    out.append("static const SpanSprite %s = %s;" % (name, span_sprite_init(name, raster)))
+    return out
+
+
+def balloon_header():
+    sky = bake_sky_tile()
+    far_clouds = bake_far_clouds()
+    near_clouds = bake_near_clouds()
+    frames = bake_collectible_frames()
+    size = frames[0][0].width
+    balloon = bake_balloon_frames()
+
+    out = []
+    out.append("// Generated by tools/bake_assets.py - do not edit")
+    out.append("#ifndef BALLOON_ASSETS_H")
+    out.append("#define BALLOON_ASSETS_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("#include \"core/gfx/IndexedSprite.h\"")
+    out.append("#include \"core/gfx/SpanSprite.h\"")
+    out.append("")
+    out.append("// Pixels are RGB565 in canvas byte order (byte-swapped)")
+    out.append("")
+    out.append("// Sunset sky bands (opaque, tiles horizontally)")
+    out.append("static const int SKY_TILE_WIDTH = %d;" % sky.width)
+    out.append("static const int SKY_TILE_HEIGHT = %d;" % sky.height)
+    out.append("static const uint16_t SKY_TILE[SKY_TILE_WIDTH * SKY_TILE_HEIGHT] = {")
+    out.append(format_pixels(sky.pixels, sky.width))
+    out.append("};")
+    out.append("")
+    out.append("// Cloud layers (opaque runs only, tile horizontally)")
+    out.extend(format_span_sprite("FAR_CLOUDS", far_clouds))
+    out.append("")
+    out.extend(format_span_sprite("NEAR_CLOUDS", near_clouds))
+    out.append("")
+    out.append("// Collectible sizes while fading, full to 50% (runs with per-pixel alpha)")
+    out.append("static const int COLLECTIBLE_SPRITE_SIZE = %d;" % size)
+    out.append("static const int COLLECTIBLE_KEYFRAMES = %d;" % len(frames))
+    names = ["COLLECTIBLE_%d" % i for i in range(len(frames))]
+    for name, (frame, alpha) in zip(names, frames):
+        out.extend(format_span_arrays(name, frame, alpha))
+    out.append("static const SpanSprite COLLECTIBLE_FRAMES[COLLECTIBLE_KEYFRAMES] = {")
+    for name, (frame, alpha) in zip(names, frames):
+        out.append("  %s," % span_sprite_init(name, frame, True))
+    out.append("};")
+    out.append("")
+    out.append("// Balloon body keyframes (2 bpp: 1 = outline, 2 = body, 3 = highlight),")
+    out.append("// squash BALLOON_SQUASH_MIN .. -BALLOON_SQUASH_MIN in BALLOON_SQUASH_STEPS steps")
+    out.append("static const float BALLOON_SQUASH_MIN = %.4ff;" % BALLOON_SQUASH_MIN)
+    out.append("static const int BALLOON_SQUASH_STEPS = %d;" % BALLOON_SQUASH_STEPS)
+    out.append("static const int BALLOON_FRAME_COUNT = %d;" % len(balloon))
+    out.append("")
+    for i, frame in enumerate(balloon):
+        out.append("static const uint8_t BALLOON_FRAME_%d_PIXELS[] = {" % i)
+        out.append(format_bytes(frame["pixels"]))
+        out.append("};")
+    out.append("")
+    out.append("struct BalloonFrame {")
+    out.append("  int8_t originX;       // Sprite top-left relative to the balloon center")
+    out.append("  int8_t originY;")
+    out.append("  int8_t bodyHeight;    // Ellipse Y radius (squash direction offset)")
+    out.append("  int8_t stringStartY;  // String anchor relative to the balloon center")
+    out.append("  IndexedSprite sprite;")
+    out.append("};")
+    out.append("")
+    out.append("static const BalloonFrame BALLOON_FRAMES[BALLOON_FRAME_COUNT] = {")
+    for i, frame in enumerate(balloon):
+        out.append("  { %d, %d, %d, %d, { %d, %d, BALLOON_FRAME_%d_PIXELS } },"
+                   % (frame["origin_x"], frame["origin_y"], frame["body_height"],
+                      frame["string_y"], frame["width"], frame["height"], i))
+    out.append("};")
+    out.append("")
+    out.append("#endif // BALLOON_ASSETS_H")
+    return "\n".join(out) + "\n"
+
+
+def write_if_changed(path, content):
+    if os.path.exists(path):
+        with open(path) as f:
+            if f.read() == content:
+                return False
+    os.makedirs(os.path.dirname(path), exist_ok=True)
+    with open(path, "w") as f:
+        f.write(content)
+    return True
+
+
+def bake(project_dir):
+    path = os.path.join(project_dir, "src", "games", "balloon", "assets", "BalloonAssets.h")
+    if write_if_changed(path, balloon_header()):
+        print("bake_assets: wrote %s" % os.path.relpath(path, project_dir))
+
+
+# PlatformIO runs this file through SCons (no __file__, env via Import)
+try:
+    Import("env")  # noqa: F821
+    bake(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        bake(os.path.dirname(os.path.dirname(os.path.abspath(sys.argv[0]))))